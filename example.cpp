@@ -16,6 +16,46 @@
 #include <type_traits>
 #include <compare>
 #include <optional>
+#include <variant>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <cassert>
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <random>
+#include <new>
+#include <bit>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <cstring>
+#include <numbers>
+#include <iomanip>
+#include <coroutine>
+#include <exception>
+#include <queue>
+#include <numeric>
+#include <stdexcept>
+
+#include "multi_array.h"
+
+#if __has_include(<sys/mman.h>)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 // =============================
 // Preprocessor Directives
@@ -30,17 +70,315 @@
     #define MESSAGE "Feature is disabled"
 #endif
 
+// SIMD level picked from the compiler's target flags (define NO_SIMD to force scalar code)
+#if !defined(NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64))
+    #define SIMD_SSE 1
+    #include <immintrin.h>
+#else
+    #define SIMD_SSE 0
+#endif
+
+#if SIMD_SSE && defined(__AVX__)
+    #define SIMD_AVX 1
+#else
+    #define SIMD_AVX 0
+#endif
+
 // Macro with variadic arguments (C++20 __VA_OPT__)
+// The never-taken printf keeps the compiler's -Wformat checks on the call site,
+// since the real formatting happens later on the logger thread.
 #define LOG(msg, ...) \
-    std::printf("[" __FILE__ ":%s:%d] " msg "\n", __func__, __LINE__ __VA_OPT__(,) __VA_ARGS__)
+    do { \
+        if (false) std::printf("[" __FILE__ ":%s:%d] " msg "\n", __func__, __LINE__ __VA_OPT__(,) __VA_ARGS__); \
+        AsyncLogger::instance().write("[" __FILE__ ":%s:%d] " msg "\n", __func__, __LINE__ __VA_OPT__(,) __VA_ARGS__); \
+    } while (false)
+
+// Asynchronous binary logger behind LOG.
+// The calling thread only copies the format pointer and the raw arguments into
+// its own SPSC ring; a background thread formats them and writes in batches.
+// Arguments must be trivially copyable, and "%s" arguments must point to
+// storage that outlives the write (string literals, __func__, ...).
+// Batches go to stderr: sharing stdout with std::cout would let a batch land
+// in the middle of a line the program is still writing.
+class AsyncLogger {
+public:
+    static constexpr size_t kRingSize = 1024;   // records per thread, power of two
+    static constexpr size_t kArgBytes = 64;     // raw argument bytes per record
+
+    static AsyncLogger& instance() {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    template<typename... Args>
+    void write(const char* fmt, Args... args) {
+        using Pack = std::tuple<Args...>;
+        static_assert((std::is_trivially_copyable_v<Args> && ...), "LOG arguments must be trivially copyable");
+        static_assert(sizeof(Pack) <= kArgBytes && alignof(Pack) <= alignof(std::max_align_t), "LOG arguments too large");
+
+        Ring&  ring = local_ring();
+        size_t head = ring.head.load(std::memory_order_relaxed);
+        while (head - ring.tail.load(std::memory_order_acquire) == kRingSize) {
+            std::this_thread::yield();  // ring full: wait for the writer thread
+        }
+        Record& record = ring.records[head & (kRingSize - 1)];
+        record.fmt    = fmt;
+        record.format = &format_record<Args...>;
+        ::new (static_cast<void*>(record.args)) Pack(args...);
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    // Blocks until every record logged so far has been written
+    void flush() {
+        while (!drained()) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    ~AsyncLogger() {
+        m_running.store(false, std::memory_order_release);
+        m_writer.join();
+    }
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+private:
+    struct Record {
+        const char* fmt;
+        int (*format)(const Record&, char*, size_t);
+        alignas(std::max_align_t) unsigned char args[kArgBytes];
+    };
+
+    struct Ring {
+        alignas(64) std::atomic<size_t> head{0};   // written by the logging thread
+        alignas(64) std::atomic<size_t> tail{0};   // written by the writer thread
+        std::array<Record, kRingSize>   records;
+    };
+
+    AsyncLogger() : m_writer([this] { run(); }) {}
+
+    template<typename... Args>
+    static int format_record(const Record& record, char* out, size_t size) {
+        const auto& pack = *std::launder(reinterpret_cast<const std::tuple<Args...>*>(record.args));
+        return std::apply([&](const auto&... args) { return std::snprintf(out, size, record.fmt, args...); }, pack);
+    }
+
+    Ring& local_ring() {
+        thread_local std::shared_ptr<Ring> ring = [this] {
+            auto created = std::make_shared<Ring>();
+            std::lock_guard lock(m_mutex);
+            m_rings.push_back(created);
+            return created;
+        }();
+        return *ring;
+    }
+
+    bool drained() {
+        std::lock_guard lock(m_mutex);
+        for (const auto& ring : m_rings) {
+            if (ring->head.load(std::memory_order_acquire) != ring->tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void run() {
+        std::string batch;
+        char        line[512];
+        while (true) {
+            bool   stopping = !m_running.load(std::memory_order_acquire);
+            size_t count    = 0;
+            {
+                std::lock_guard lock(m_mutex);
+                for (auto& ring : m_rings) {
+                    size_t tail = ring->tail.load(std::memory_order_relaxed);
+                    size_t head = ring->head.load(std::memory_order_acquire);
+                    for (; tail != head; ++tail, ++count) {
+                        const Record& record = ring->records[tail & (kRingSize - 1)];
+                        int len = record.format(record, line, sizeof(line));
+                        batch.append(line, std::min<size_t>(std::max(len, 0), sizeof(line) - 1));
+                    }
+                    ring->tail.store(tail, std::memory_order_release);
+                }
+                // Rings whose thread has exited are only referenced here
+                std::erase_if(m_rings, [](const auto& ring) {
+                    return ring.use_count() == 1 && ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_relaxed);
+                });
+            }
+            if (!batch.empty()) {
+                std::fwrite(batch.data(), 1, batch.size(), stderr);
+                std::fflush(stderr);
+                batch.clear();
+            }
+            if (count == 0) {
+                if (stopping) break;
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+    }
+
+    std::mutex                         m_mutex;    // guards m_rings, taken once per thread by loggers
+    std::vector<std::shared_ptr<Ring>> m_rings;
+    std::atomic<bool>                  m_running{true};
+    std::thread                        m_writer;
+};
 
 // Stringification and token-pasting macros
 #define STRINGIFY(x) #x
 #define CONCAT(a, b) a##b
+#define CONCAT_EXPANDED(a, b) CONCAT(a, b) // expands macro arguments such as __LINE__ first
 
 // Diagnostic directive (C++23)
 //#warning "Compiling example.cpp"
 
+// =============================
+// Benchmarking
+// =============================
+
+// Keeps the optimizer from discarding a value computed only for timing.
+// The non-const overload also makes the value opaque, so inputs passed
+// through it cannot be constant-folded.
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// Small trivially copyable values go through a register, anything else through
+// memory. A "+" on a multi-alternative constraint such as "+m,r" is miscompiled
+// by GCC, so each case gets a single alternative.
+template<typename T>
+inline void do_not_optimize(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(void*)) {
+        asm volatile("" : "+r"(value) : : "memory");
+    } else {
+        asm volatile("" : "+m"(value) : : "memory");
+    }
+#else
+    static volatile void* sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// Per-call timings in nanoseconds
+struct BenchResult {
+    std::string name;
+    size_t      samples;
+    size_t      batch;      // calls per sample
+    double      mean, min, p50, p90, p99, max;
+};
+
+struct BenchOptions {
+    size_t warmup  = 20;
+    size_t samples = 200;
+    std::chrono::nanoseconds min_sample_time{20'000};
+};
+
+class BenchReport {
+public:
+    explicit BenchReport(BenchOptions options = {}) : m_options(options) {}
+
+    // Calibrates the batch size until one sample lasts at least
+    // min_sample_time, so clock overhead stays out of the per-call figures.
+    template<typename F>
+    const BenchResult& run(std::string name, F&& f) {
+        using clock = std::chrono::steady_clock;
+
+        auto time_batch = [&f](size_t batch) {
+            auto start = clock::now();
+            for (size_t i = 0; i < batch; ++i) {
+                f();
+            }
+            return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        };
+
+        size_t batch = 1;
+        while (batch < (size_t{1} << 30) && time_batch(batch) < m_options.min_sample_time.count()) {
+            batch *= 2;
+        }
+        for (size_t i = 0; i < m_options.warmup; ++i) {
+            time_batch(batch);
+        }
+
+        std::vector<double> ns(m_options.samples);
+        for (auto& t : ns) {
+            t = time_batch(batch) / static_cast<double>(batch);
+        }
+        std::sort(ns.begin(), ns.end());
+
+        auto percentile = [&ns](double p) {
+            return ns[std::min(ns.size() - 1, static_cast<size_t>(p * static_cast<double>(ns.size())))];
+        };
+        double total = 0;
+        for (double t : ns) total += t;
+
+        return m_results.emplace_back(BenchResult{
+            std::move(name), ns.size(), batch, total / static_cast<double>(ns.size()),
+            ns.front(), percentile(0.50), percentile(0.90), percentile(0.99), ns.back()
+        });
+    }
+
+    void print_table(std::ostream& os) const {
+        os << "benchmark                                       p50 ns      p90 ns      p99 ns     mean ns\n";
+        for (const auto& r : m_results) {
+            char line[160];
+            std::snprintf(line, sizeof(line), "%-44s %11.2f %11.2f %11.2f %11.2f\n",
+                          r.name.c_str(), r.p50, r.p90, r.p99, r.mean);
+            os << line;
+        }
+    }
+
+    void write_csv(std::ostream& os) const {
+        os << "name,samples,batch,mean_ns,min_ns,p50_ns,p90_ns,p99_ns,max_ns\n";
+        for (const auto& r : m_results) {
+            os << '"' << r.name << "\"," << r.samples << ',' << r.batch << ',' << r.mean << ','
+               << r.min << ',' << r.p50 << ',' << r.p90 << ',' << r.p99 << ',' << r.max << "\n";
+        }
+    }
+
+    void write_json(std::ostream& os) const {
+        os << "[\n";
+        for (size_t i = 0; i < m_results.size(); ++i) {
+            const auto& r = m_results[i];
+            os << "  {\"name\": \"" << r.name << "\", \"samples\": " << r.samples << ", \"batch\": " << r.batch
+               << ", \"mean_ns\": " << r.mean << ", \"min_ns\": " << r.min << ", \"p50_ns\": " << r.p50
+               << ", \"p90_ns\": " << r.p90 << ", \"p99_ns\": " << r.p99 << ", \"max_ns\": " << r.max
+               << (i + 1 < m_results.size() ? "},\n" : "}\n");
+        }
+        os << "]\n";
+    }
+
+private:
+    BenchOptions             m_options;
+    std::vector<BenchResult> m_results;
+};
+
+// Silences std::cout while the test_* sections are being timed
+class MuteCout {
+    struct NullBuffer : std::streambuf {
+        int overflow(int c) override { return c; }
+    };
+
+public:
+    MuteCout() : m_old(std::cout.rdbuf(&m_null)) {}
+    ~MuteCout() { std::cout.rdbuf(m_old); }
+    MuteCout(const MuteCout&) = delete;
+    MuteCout& operator=(const MuteCout&) = delete;
+
+private:
+    NullBuffer      m_null;
+    std::streambuf* m_old;
+};
+
 // =============================
 // Constants
 // =============================
@@ -86,27 +424,176 @@ struct B : public A {
 };
 
 // C++20: constexpr dynamic allocation
-// This is not yet compiling on GCC 14.3/15.1, MSVC 19.43, ...
+// Memory allocated during constant evaluation has to be freed before that
+// evaluation ends, so a heap-built structure can't be a constexpr variable
+// itself. freeze<Build>() runs the builder inside a constant expression,
+// copies its result into a std::array of exactly the right size and lets
+// the builder free everything; only the flat array reaches the program, with
+// no startup cost and no runtime allocation.
 #ifdef __cpp_constexpr_dynamic_alloc
 
-//struct Node {
-//    int value;
-//    Node* next;
-//    constexpr Node(int v, Node* n = nullptr) : value(v), next(n) {}
-//};
-//
-//constexpr Node* build_list(int n) {
-//    if (n <= 0) return nullptr;
-//    Node* head = new Node(n);
-//    Node* current = head;
-//    for (int i = n - 1; i > 0; --i) {
-//        current->next = new Node(i);
-//        current = current->next;
-//    }
-//    return head;
-//}
-//
-//constexpr Node* my_list = build_list(5);
+struct Node {
+    int value;
+    Node* next;
+    constexpr Node(int v, Node* n = nullptr) : value(v), next(n) {}
+};
+
+constexpr Node* build_list(int n) {
+    if (n <= 0) return nullptr;
+    Node* head = new Node(n);
+    Node* current = head;
+    for (int i = n - 1; i > 0; --i) {
+        current->next = new Node(i);
+        current = current->next;
+    }
+    return head;
+}
+
+// Copies the list's values out and frees its nodes
+constexpr std::vector<int> drain_list(Node* head) {
+    std::vector<int> values;
+    while (head) {
+        values.push_back(head->value);
+        delete std::exchange(head, head->next);
+    }
+    return values;
+}
+
+// Build is a captureless lambda returning a std::vector. It runs twice: once
+// to size the array, once to fill it.
+template<auto Build>
+consteval auto freeze() {
+    using T = typename decltype(Build())::value_type;
+    constexpr size_t kSize = Build().size();
+    std::array<T, kSize> frozen{};
+    auto built = Build();
+    std::copy(built.begin(), built.end(), frozen.begin());
+    return frozen;
+}
+
+constinit const auto my_list = freeze<[] { return drain_list(build_list(5)); }>();
+
+// Sorted key/value table with binary-search lookup
+template<typename K, typename V, size_t N>
+struct FrozenMap {
+    std::array<std::pair<K, V>, N> entries;
+
+    constexpr const V* find(const K& key) const {
+        auto it = std::lower_bound(entries.begin(), entries.end(), key, [](const auto& entry, const K& k) { return entry.first < k; });
+        return (it != entries.end() && it->first == key) ? &it->second : nullptr;
+    }
+};
+
+// Sorts map entries by key; a duplicate key fails constant evaluation
+template<typename K, typename V>
+constexpr std::vector<std::pair<K, V>> sorted_by_key(std::vector<std::pair<K, V>> entries) {
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    if (std::adjacent_find(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first == b.first; }) != entries.end()) {
+        throw "duplicate key in frozen map";
+    }
+    return entries;
+}
+
+// Trie node in breadth-first order: a node's children are adjacent and
+// sorted by character, starting at first_child
+struct TrieEntry {
+    char     ch;
+    int      value;         // -1 when no word ends here
+    uint32_t first_child;
+    uint32_t child_count;
+};
+
+// Trie of heap nodes, built at compile time and flattened breadth first
+class TrieBuilder {
+public:
+    constexpr TrieBuilder() : m_root(new TrieNode{}) {}
+    constexpr ~TrieBuilder() { destroy(m_root); }
+    TrieBuilder(const TrieBuilder&) = delete;
+    TrieBuilder& operator=(const TrieBuilder&) = delete;
+
+    constexpr TrieBuilder& insert(std::string_view word, int value) {
+        TrieNode* node = m_root;
+        for (char c : word) {
+            auto it = std::lower_bound(node->children.begin(), node->children.end(), c, [](const TrieNode* child, char ch) { return child->ch < ch; });
+            if (it == node->children.end() || (*it)->ch != c) {
+                it = node->children.insert(it, new TrieNode{c, -1, {}});
+            }
+            node = *it;
+        }
+        node->value = value;
+        return *this;
+    }
+
+    constexpr std::vector<TrieEntry> flatten() const {
+        std::vector<const TrieNode*> order{m_root};
+        std::vector<TrieEntry> entries;
+        for (size_t i = 0; i < order.size(); ++i) {
+            const TrieNode* node = order[i];
+            entries.push_back({node->ch, node->value, static_cast<uint32_t>(order.size()), static_cast<uint32_t>(node->children.size())});
+            order.insert(order.end(), node->children.begin(), node->children.end());
+        }
+        return entries;
+    }
+
+private:
+    struct TrieNode {
+        char ch = '\0';
+        int  value = -1;
+        std::vector<TrieNode*> children;
+    };
+
+    static constexpr void destroy(TrieNode* node) {
+        for (TrieNode* child : node->children) destroy(child);
+        delete node;
+    }
+
+    TrieNode* m_root;
+};
+
+template<size_t N>
+struct FrozenTrie {
+    std::array<TrieEntry, N> nodes;
+
+    // Value stored for word, or -1
+    constexpr int find(std::string_view word) const {
+        size_t node = 0;
+        for (char c : word) {
+            if (!child(node, c, node)) return -1;
+        }
+        return nodes[node].value;
+    }
+
+    // Length of the longest stored word that prefixes text, or 0
+    constexpr size_t longest_prefix(std::string_view text) const {
+        size_t node = 0, longest = 0;
+        for (size_t i = 0; i < text.size() && child(node, text[i], node); ++i) {
+            if (nodes[node].value >= 0) longest = i + 1;
+        }
+        return longest;
+    }
+
+private:
+    constexpr bool child(size_t node, char c, size_t& out) const {
+        auto first = nodes.begin() + nodes[node].first_child;
+        auto last  = first + nodes[node].child_count;
+        auto it = std::lower_bound(first, last, c, [](const TrieEntry& entry, char ch) { return entry.ch < ch; });
+        if (it == last || it->ch != c) return false;
+        out = static_cast<size_t>(it - nodes.begin());
+        return true;
+    }
+};
+
+// Routing and keyword tables with no startup cost
+constinit const FrozenMap routes{freeze<[] {
+    return sorted_by_key<std::string_view, int>({{"/users", 2}, {"/", 0}, {"/users/settings", 3}, {"/login", 1}});
+}>()};
+
+constinit const FrozenTrie keywords{freeze<[] {
+    constexpr std::string_view words[] = {"break", "case", "const", "consteval", "constexpr", "constinit", "continue"};
+    TrieBuilder trie;
+    for (size_t i = 0; i < std::size(words); ++i) trie.insert(words[i], static_cast<int>(i));
+    return trie.flatten();
+}>()};
 #endif
 
 // constinit (C++20)
@@ -181,6 +668,160 @@ constexpr float operator""_deg(long double deg) {
     return static_cast<float>(deg * 3.14159265358979323846L / 180.0L);
 }
 
+// Zero-copy tokenizer (std::string_view)
+// Tokens are views into the original text, so nothing is copied or allocated.
+// The text is classified 64 bytes at a time into a delimiter bitmask (SSE2
+// compares when available); token starts and ends are then bit operations on
+// that mask, so there is no per-byte branch.
+// More than kMaxDelimiters delimiters use the lookup table for every byte.
+class Tokenizer {
+public:
+    static constexpr size_t kMaxDelimiters = 8;    // SSE compares per 16-byte chunk
+
+    Tokenizer(std::string_view text, std::string_view delimiters = " \t\r\n") : m_text(text) {
+        if (delimiters.empty()) {
+            throw std::invalid_argument("Tokenizer: no delimiters");
+        }
+        m_padding = delimiters.front();
+        m_delimiter_count = delimiters.size();
+        for (size_t d = 0; d < delimiters.size(); ++d) {
+            m_is_delimiter[static_cast<unsigned char>(delimiters[d])] = true;
+#if SIMD_SSE
+            if (d < kMaxDelimiters) m_simd_delimiters[d] = _mm_set1_epi8(delimiters[d]);
+#endif
+        }
+    }
+
+    std::optional<std::string_view> next() {
+        while (m_starts == 0) {
+            if (!advance()) return std::nullopt;
+        }
+        size_t begin = m_block + static_cast<size_t>(std::countr_zero(m_starts));
+        m_starts &= m_starts - 1;
+
+        while (m_ends == 0) {
+            if (!advance()) return m_text.substr(begin); // token runs to the end of the text
+        }
+        size_t end = m_block + static_cast<size_t>(std::countr_zero(m_ends));
+        m_ends &= m_ends - 1;
+        return m_text.substr(begin, end - begin);
+    }
+
+private:
+    // Classifies the next 64-byte block and derives its token start/end bits
+    bool advance() {
+        if (m_next >= m_text.size()) return false;
+        m_block = m_next;
+        m_next += 64;
+
+        uint64_t delims    = delimiter_mask(m_block);
+        uint64_t nondelims = ~delims;
+        m_starts = nondelims & ((delims << 1) | m_prev_delim);
+        m_ends   = delims & ((nondelims << 1) | (m_prev_delim ^ 1));
+        m_prev_delim = delims >> 63;
+        return true;
+    }
+
+    // Bit i is set when byte block + i is a delimiter; bytes past the end count as delimiters
+    uint64_t delimiter_mask(size_t block) const {
+        const char* bytes = m_text.data() + block;
+        char tail[64];
+        if (m_text.size() - block < 64) {
+            std::fill(std::begin(tail), std::end(tail), m_padding);
+            std::copy(bytes, m_text.data() + m_text.size(), tail);
+            bytes = tail;
+        }
+
+        uint64_t mask = 0;
+#if SIMD_SSE
+        if (m_delimiter_count <= kMaxDelimiters) {
+            for (int part = 0; part < 4; ++part) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + part * 16));
+                __m128i hits  = _mm_setzero_si128();
+                for (size_t d = 0; d < m_delimiter_count; ++d) {
+                    hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, m_simd_delimiters[d]));
+                }
+                mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(hits))) << (part * 16);
+            }
+            return mask;
+        }
+#endif
+        for (size_t i = 0; i < 64; ++i) {
+            mask |= static_cast<uint64_t>(m_is_delimiter[static_cast<unsigned char>(bytes[i])]) << i;
+        }
+        return mask;
+    }
+
+    std::string_view      m_text;
+    size_t                m_block = 0;       // offset of the classified block
+    size_t                m_next  = 0;       // offset of the next block to classify
+    uint64_t              m_starts = 0;      // unconsumed token starts in the block
+    uint64_t              m_ends   = 0;      // unconsumed token ends in the block
+    uint64_t              m_prev_delim = 1;  // whether the byte before the block is a delimiter
+    std::array<bool, 256> m_is_delimiter{};
+    char                  m_padding = ' ';
+    size_t                m_delimiter_count = 0;
+#if SIMD_SSE
+    __m128i               m_simd_delimiters[kMaxDelimiters];
+#endif
+};
+
+// Path in the temp directory with a per-run suffix, so concurrent runs don't
+// overwrite each other's files
+inline std::string unique_temp_path(std::string_view stem) {
+    static const unsigned run_id = std::random_device{}();
+    return (std::filesystem::temp_directory_path() / (std::string(stem) + "_" + std::to_string(run_id) + ".bin")).string();
+}
+
+// Read-only view of a whole file: mmap where available (pages load on demand),
+// otherwise the file is read into memory once
+class MappedFile {
+public:
+    explicit MappedFile(const char* path) {
+#if __has_include(<sys/mman.h>)
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return;
+        struct stat st{};
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                ::madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+                m_view = {static_cast<const char*>(data), static_cast<size_t>(st.st_size)};
+                m_open = true;
+            }
+        }
+        ::close(fd);
+#else
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return;
+        m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_view = m_buffer;
+        m_open = true;
+#endif
+    }
+
+    ~MappedFile() {
+#if __has_include(<sys/mman.h>)
+        if (!m_view.empty()) {
+            ::munmap(const_cast<char*>(m_view.data()), m_view.size());
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool             is_open() const { return m_open; }
+    std::string_view view() const    { return m_view; }
+
+private:
+    std::string_view m_view;
+    bool             m_open = false;
+#if !__has_include(<sys/mman.h>)
+    std::string      m_buffer;
+#endif
+};
+
 // =============================
 // Initialization
 // =============================
@@ -193,9 +834,84 @@ void print_values(std::initializer_list<int> values) {
     std::cout << "\n";
 }
 
+// Interned strings
+// Every distinct string is stored once, together with its hash, in a global
+// table; an InternedString is a single pointer to that entry. Copies are free,
+// equality is one pointer compare and hash() is a load. The characters sit
+// inline in the table entry, one allocation per distinct string whatever its
+// length. The table is a fixed array of lock-free chains, and entries live
+// until the program exits, so interning is explicit: comparing against plain
+// text compares characters and never adds the text to the table.
+class InternedString {
+public:
+    InternedString() : InternedString(std::string_view{}) {}
+    explicit InternedString(const char* text) : InternedString(std::string_view(text)) {}
+    explicit InternedString(const std::string& text) : InternedString(std::string_view(text)) {}
+    explicit InternedString(std::string_view text) : m_entry(intern(text)) {}
+
+    std::string_view view() const  { return {m_entry->chars(), m_entry->size}; }
+    const char*      c_str() const { return m_entry->chars(); }
+    size_t           size() const  { return m_entry->size; }
+    bool             empty() const { return m_entry->size == 0; }
+    size_t           hash() const  { return m_entry->hash; }
+    operator std::string_view() const { return view(); }
+
+    friend bool operator==(InternedString a, InternedString b) { return a.m_entry == b.m_entry; }
+    friend bool operator==(InternedString a, std::string_view b) { return a.view() == b; }
+    friend std::ostream& operator<<(std::ostream& os, InternedString s) { return os << s.view(); }
+
+private:
+    struct Entry {
+        size_t hash;
+        size_t size;
+        Entry* next;    // set before the entry is published, never changed after
+        const char* chars() const { return reinterpret_cast<const char*>(this + 1); }
+    };
+
+    static constexpr size_t kBuckets = 1 << 18;
+
+    // Searches [first, last) of one chain
+    static const Entry* find(const Entry* first, const Entry* last, size_t hash, std::string_view text) {
+        for (const Entry* e = first; e != last; e = e->next) {
+            if (e->hash == hash && e->size == text.size() && std::memcmp(e->chars(), text.data(), text.size()) == 0) return e;
+        }
+        return nullptr;
+    }
+
+    static const Entry* intern(std::string_view text) {
+        static constinit std::array<std::atomic<Entry*>, kBuckets> s_buckets{};
+        size_t hash = std::hash<std::string_view>{}(text);
+        std::atomic<Entry*>& head = s_buckets[hash & (kBuckets - 1)];
+
+        Entry* first = head.load(std::memory_order_acquire);
+        if (const Entry* found = find(first, nullptr, hash, text)) return found;
+
+        Entry* entry = ::new (::operator new(sizeof(Entry) + text.size() + 1)) Entry{hash, text.size(), first};
+        char*  chars = reinterpret_cast<char*>(entry + 1);
+        std::memcpy(chars, text.data(), text.size());
+        chars[text.size()] = '\0';
+        while (!head.compare_exchange_weak(entry->next, entry, std::memory_order_release, std::memory_order_acquire)) {
+            // Another thread published first: only the entries it added need checking
+            if (const Entry* found = find(entry->next, first, hash, text)) {
+                ::operator delete(entry);
+                return found;
+            }
+            first = entry->next;
+        }
+        return entry;
+    }
+
+    const Entry* m_entry;
+};
+
+template<>
+struct std::hash<InternedString> {
+    size_t operator()(InternedString s) const noexcept { return s.hash(); }
+};
+
 // Uniform initialization (C++11)
 struct Person {
-    std::string name;
+    InternedString name;
     int age;
 };
 
@@ -206,7 +922,10 @@ void test_uniform_initialization() {
     int* p{}; // Initialized to nullptr
     int arr[] {1, 2, 3, 4};
 
-    Person p1{"Alice", 30};
+    Person p1{InternedString("Alice"), 30};
+    Person p2{InternedString(std::string("Al") + "ice"), 31};
+    std::cout << "Person names interned: " << std::boolalpha << (p1.name == p2.name) << ", same storage: " << (p1.name.c_str() == p2.name.c_str())
+              << ", sizeof(Person): " << sizeof(Person) << "\n";
     print_values({1, 2, 3, 4, 5});
 }
 
@@ -229,11 +948,201 @@ struct Point {
     int z;
 };
 
+// Structure-of-arrays storage for flat aggregates (C++17 structured bindings)
+// The member list is discovered by probing aggregate initialization, then each
+// member gets its own contiguous column, so bulk loops over one field run at
+// full SIMD width instead of striding across whole structs.
+struct AnyField {
+    template<typename U>
+    operator U() const;
+};
+
+template<typename T, typename... Fields>
+consteval size_t field_count() {
+    if constexpr (requires { T{Fields{}..., AnyField{}}; }) {
+        return field_count<T, Fields..., AnyField>();
+    } else {
+        return sizeof...(Fields);
+    }
+}
+
+// Members of a flat aggregate (no bases, no array members) as a tuple of references
+template<typename T>
+constexpr auto members_of(T& value) {
+    constexpr size_t n = field_count<std::remove_cv_t<T>>();
+    static_assert(n >= 1 && n <= 6, "members_of supports aggregates of 1 to 6 members");
+    if constexpr (n == 1) { auto& [a] = value;                return std::tie(a); }
+    else if constexpr (n == 2) { auto& [a, b] = value;             return std::tie(a, b); }
+    else if constexpr (n == 3) { auto& [a, b, c] = value;          return std::tie(a, b, c); }
+    else if constexpr (n == 4) { auto& [a, b, c, d] = value;       return std::tie(a, b, c, d); }
+    else if constexpr (n == 5) { auto& [a, b, c, d, e] = value;    return std::tie(a, b, c, d, e); }
+    else                       { auto& [a, b, c, d, e, f] = value; return std::tie(a, b, c, d, e, f); }
+}
+
+template<typename T>
+class SoA {
+    template<typename Tuple> struct columns_of;
+    template<typename... Ms> struct columns_of<std::tuple<Ms&...>> {
+        using type = std::tuple<std::vector<Ms>...>;
+    };
+    using Columns = typename columns_of<decltype(members_of(std::declval<T&>()))>::type;
+    static constexpr size_t kFields = std::tuple_size_v<Columns>;
+
+public:
+    // Takes the aggregate itself, so push_back({ .x = 1, .z = 3 }) still works
+    void push_back(const T& value) {
+        auto members = members_of(value);
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (std::get<I>(m_columns).push_back(std::get<I>(members)), ...);
+        }(std::make_index_sequence<kFields>{});
+    }
+
+    // Gathers element i back into an aggregate
+    T operator[](size_t i) const {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return T{std::get<I>(m_columns)[i]...};
+        }(std::make_index_sequence<kFields>{});
+    }
+
+    void reserve(size_t n) {
+        std::apply([n](auto&... column) { (column.reserve(n), ...); }, m_columns);
+    }
+
+    size_t size() const { return std::get<0>(m_columns).size(); }
+
+    template<size_t I> auto column()       { return std::span(std::get<I>(m_columns)); }
+    template<size_t I> auto column() const { return std::span(std::get<I>(m_columns)); }
+
+private:
+    Columns m_columns;
+};
+
+// Struct layout analysis (sizeof / alignof)
+// Offsets follow the layout rule for standard-layout types: every field at the
+// next multiple of its alignment, the whole rounded up to the largest
+// alignment. matches_sizeof checks that model against the compiler, so
+// #pragma pack or [[no_unique_address]] show up as a mismatch instead of a
+// wrong report. Cache-line figures assume the object starts on a line
+// boundary (alignas(64), or element 0 of a line-aligned array).
+inline constexpr size_t kCacheLine = 64;
+
+template<typename T> inline constexpr bool is_atomic_v = false;
+template<typename T> inline constexpr bool is_atomic_v<std::atomic<T>> = true;
+
+struct FieldLayout {
+    size_t offset;
+    size_t size;
+    size_t align;
+    size_t padding_before;
+    bool   atomic;
+    bool   straddles;     // crosses a cache-line boundary
+};
+
+template<size_t N>
+struct LayoutReport {
+    size_t size;
+    size_t align;
+    bool   matches_sizeof;
+    std::array<FieldLayout, N> fields;
+    size_t padding;              // interior and tail padding bytes
+    size_t tail_padding;
+    size_t straddling_fields;
+    size_t false_sharing_pairs;  // pairs of atomic fields on a common cache line
+    std::array<size_t, N> suggested_order; // field indices, largest alignment first
+    size_t suggested_size;
+
+    constexpr size_t savings() const { return size - suggested_size; }
+};
+
+// Layout of T from its field types in declaration order; a base class counts
+// as a leading field. With no Fields, flat aggregates are decomposed through
+// members_of.
+template<typename T, typename... Fields>
+consteval auto layout_of() {
+    if constexpr (sizeof...(Fields) == 0) {
+        return []<typename... Ms>(std::tuple<Ms&...>*) {
+            return layout_of<T, Ms...>();
+        }(static_cast<decltype(members_of(std::declval<T&>()))*>(nullptr));
+    } else {
+        constexpr size_t N = sizeof...(Fields);
+        constexpr std::array<size_t, N> sizes{sizeof(Fields)...};
+        constexpr std::array<size_t, N> aligns{alignof(Fields)...};
+        constexpr std::array<bool, N>   atomics{is_atomic_v<Fields>...};
+        constexpr size_t max_align = std::max({alignof(Fields)...});
+        auto align_up = [](size_t n, size_t a) { return (n + a - 1) / a * a; };
+
+        LayoutReport<N> report{};
+        report.size  = sizeof(T);
+        report.align = alignof(T);
+        size_t end = 0, used = 0;
+        for (size_t i = 0; i < N; ++i) {
+            size_t offset = align_up(end, aligns[i]);
+            report.fields[i] = {offset, sizes[i], aligns[i], offset - end, atomics[i], offset % kCacheLine + sizes[i] > kCacheLine};
+            report.straddling_fields += report.fields[i].straddles;
+            end   = offset + sizes[i];
+            used += sizes[i];
+        }
+        report.matches_sizeof = align_up(end, max_align) == sizeof(T) && max_align == alignof(T);
+        report.padding        = sizeof(T) - used;
+        report.tail_padding   = sizeof(T) - std::min(end, sizeof(T));
+
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = i + 1; j < N; ++j) {
+                const FieldLayout& a = report.fields[i];
+                const FieldLayout& b = report.fields[j];
+                if (a.atomic && b.atomic && (a.offset + a.size - 1) / kCacheLine >= b.offset / kCacheLine) {
+                    ++report.false_sharing_pairs;
+                }
+            }
+        }
+
+        // Decreasing alignment leaves no interior padding between fields
+        for (size_t i = 0; i < N; ++i) report.suggested_order[i] = i;
+        std::sort(report.suggested_order.begin(), report.suggested_order.end(), [&](size_t a, size_t b) {
+            return aligns[a] != aligns[b] ? aligns[a] > aligns[b] : (sizes[a] != sizes[b] ? sizes[a] > sizes[b] : a < b);
+        });
+        size_t reordered = 0;
+        for (size_t i : report.suggested_order) reordered = align_up(reordered, aligns[i]) + sizes[i];
+        report.suggested_size = std::min(align_up(reordered, max_align), sizeof(T));
+        return report;
+    }
+}
+
+// Prints the report for T, with a marker at each cache-line boundary
+template<typename T, typename... Fields>
+void dump_layout(std::ostream& os, std::string_view name) {
+    constexpr auto report = layout_of<T, Fields...>();
+    os << name << ": " << report.size << " bytes, align " << report.align << ", " << report.padding << " padding bytes\n";
+    if (!report.matches_sizeof) {
+        os << "  (layout model disagrees with sizeof/alignof: packed or unusual layout, offsets are estimates)\n";
+    }
+    size_t line = 0;
+    for (size_t i = 0; i < report.fields.size(); ++i) {
+        const FieldLayout& f = report.fields[i];
+        while (f.offset / kCacheLine > line) os << "  -- cache line " << ++line << " --\n";
+        if (f.padding_before) os << "  " << std::setw(12) << f.padding_before << " bytes padding\n";
+        os << "  [" << i << "] offset " << std::setw(4) << f.offset << "  size " << std::setw(4) << f.size << "  align " << f.align
+           << (f.atomic ? "  atomic" : "") << (f.straddles ? "  STRADDLES LINE" : "") << "\n";
+    }
+    if (report.tail_padding) os << "  " << std::setw(12) << report.tail_padding << " bytes tail padding\n";
+    os << "  straddling fields: " << report.straddling_fields << ", atomic pairs sharing a line: " << report.false_sharing_pairs << "\n";
+    os << "  suggested order:";
+    for (size_t i : report.suggested_order) os << " " << i;
+    os << " (" << report.suggested_size << " bytes, saves " << report.savings() << ")\n";
+}
+
 void test_designated_initializers() {
     Point p1 { .x = 1, .y = 2, .z = 3 };
     Point p2 { .x = 5,         .z = 6 }; // y is zero-initialized
     std::cout << "Point p1: (" << p1.x << ", " << p1.y << ", " << p1.z << ")\n";
     std::cout << "Point p2: (" << p2.x << ", " << p2.y << ", " << p2.z << ")\n";
+
+    SoA<Point> points;
+    points.push_back({ .x = 1, .y = 2, .z = 3 });
+    points.push_back({ .x = 5, .y = 0, .z = 6 });
+    for (int& x : points.column<0>()) x *= 10; // contiguous: vectorizes
+    Point p3 = points[1];
+    std::cout << "SoA<Point>[1]: (" << p3.x << ", " << p3.y << ", " << p3.z << ")\n";
 }
 
 // =============================
@@ -288,41 +1197,170 @@ consteval auto ipow_ct(auto base, auto exp) {
     while (exp) {
         if (exp & 1) result *= base;
         exp >>= 1;
-        base *= base;
+        if (exp) base *= base; // skip the last square, it could overflow
     }
     return result;
 };
 
-void test_control_flow() {
-    std::vector<int> vec = {1, 2, 3, 4, 5};
-
-    // Range-based for loop (C++11)
-    for (auto& value : vec) {
-        value += 1;
+// Compile-time lookup tables.
+// Every entry is computed during constant evaluation and the result lands in
+// constinit read-only data, so a hot loop pays one indexed load per value.
+template<typename T, size_t N, typename F>
+consteval std::array<T, N> make_table(F f) {
+    std::array<T, N> table{};
+    for (size_t i = 0; i < N; ++i) {
+        table[i] = f(i);
     }
+    return table;
+}
 
-    // Range-based for loop with initializer (C++20)
-    for (size_t idx = 0; const auto& val : vec) {
-        std::cout << idx++ << ": " << val << "\n";
+// Base^0 .. Base^(N-1)
+template<long long Base, size_t N>
+constinit const std::array<long long, N> pow_table =
+    make_table<long long, N>([](size_t exp) consteval { return ipow_ct(Base, exp); });
+
+// 0! .. 12! (13! overflows int)
+constinit const std::array<int, 13> factorial_table =
+    make_table<int, 13>([](size_t n) { return factorial_constexpr(static_cast<int>(n)); });
+
+// Pascal's triangle: binomial_table<N>[n][k] == C(n, k) for n < N
+template<size_t N>
+consteval std::array<std::array<long long, N>, N> make_binomial_table() {
+    std::array<std::array<long long, N>, N> table{};
+    for (size_t n = 0; n < N; ++n) {
+        table[n][0] = 1;
+        for (size_t k = 1; k <= n; ++k) {
+            table[n][k] = table[n - 1][k - 1] + table[n - 1][k];
+        }
     }
+    return table;
+}
 
-    // if with initializer (C++17)
-    if (auto it = std::find(vec.begin(), vec.end(), 3); it != vec.end()) {
-        std::cout << "Found 3 in modified vec\n";
+template<size_t N>
+constinit const auto binomial_table = make_binomial_table<N>();
+
+// Q1.15 fixed-point sine for every whole degree, built from operator""_deg
+constexpr double sin_taylor(double x) {
+    constexpr double pi = 3.14159265358979323846;
+    if (x > pi) x -= 2 * pi;
+    double term = x, sum = x;
+    for (int n = 1; n < 12; ++n) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum  += term;
     }
+    return sum;
+}
 
-    // if constexpr (C++17)
-    auto getValue = [](auto t) {
-        if constexpr (std::is_pointer_v<decltype(t)>) {
-            return *t;
-        } else {
-            return t;
-        }
-    };
-    int x = 10;
-    int* px = &x;
+constinit const std::array<int16_t, 360> sin_q15_table = make_table<int16_t, 360>([](size_t deg) {
+    double s = sin_taylor(operator""_deg(static_cast<long double>(deg)));
+    return static_cast<int16_t>(s * 32767.0 + (s < 0 ? -0.5 : 0.5));
+});
+
+inline int16_t sin_q15(int deg) { return sin_q15_table[static_cast<size_t>((deg % 360 + 360) % 360)]; }
+inline int16_t cos_q15(int deg) { return sin_q15(deg + 90); }
+
+// Compile-time type dispatch
+// A TypeDispatch is a constexpr table of (trait, kernel) rules. kernel_for<T>
+// selects the first rule whose trait holds for T at compile time, and
+// apply_batch runs that single kernel over a whole range, so the choice is made
+// once per batch and the loop body is a plain, vectorizable kernel call.
+template<typename>
+struct AnyType : std::true_type {};
+
+template<typename T>
+using IsFloat = std::is_same<T, float>;
+
+template<template<typename> typename Trait, typename Kernel>
+struct DispatchRule {
+    Kernel kernel;
+
+    template<typename T>
+    static constexpr bool matches = Trait<T>::value;
+};
+
+template<template<typename> typename Trait, typename Kernel>
+constexpr DispatchRule<Trait, Kernel> rule(Kernel kernel) {
+    return {kernel};
+}
+
+template<typename... Rules>
+class TypeDispatch {
+public:
+    constexpr explicit TypeDispatch(Rules... rules) : m_rules(rules...) {}
+
+    template<typename T>
+    static constexpr size_t index_for = [] {
+        constexpr bool matches[] = {Rules::template matches<T>...};
+        for (size_t i = 0; i < sizeof...(Rules); ++i) {
+            if (matches[i]) return i;
+        }
+        return sizeof...(Rules);
+    }();
+
+    template<typename T>
+    constexpr const auto& kernel_for() const {
+        static_assert(index_for<T> < sizeof...(Rules), "No dispatch rule matches this type");
+        return std::get<index_for<T>>(m_rules).kernel;
+    }
+
+    template<typename T, typename... Args>
+    constexpr auto operator()(T value, const Args&... args) const {
+        return kernel_for<T>()(value, args...);
+    }
+
+    // out[i] = kernel(in[i], args...) with the kernel chosen once for the element type
+    template<std::ranges::contiguous_range In, std::ranges::contiguous_range Out, typename... Args>
+    void apply_batch(const In& in, Out&& out, const Args&... args) const {
+        assert(std::ranges::size(out) >= std::ranges::size(in));
+        const auto& kernel = kernel_for<std::ranges::range_value_t<In>>();
+        const auto* src = std::ranges::data(in);
+        auto*       dst = std::ranges::data(out);
+        for (size_t i = 0, n = std::ranges::size(in); i < n; ++i) {
+            dst[i] = kernel(src[i], args...);
+        }
+    }
+
+private:
+    std::tuple<Rules...> m_rules;
+};
+
+// getValue from test_control_flow as a dispatch table
+inline constexpr TypeDispatch value_dispatch{
+    rule<std::is_pointer>([](auto p) { return *p; }),
+    rule<AnyType>([](auto v) { return v; }),
+};
+
+void test_control_flow() {
+    std::vector<int> vec = {1, 2, 3, 4, 5};
+
+    // Range-based for loop (C++11)
+    for (auto& value : vec) {
+        value += 1;
+    }
+
+    // Range-based for loop with initializer (C++20)
+    for (size_t idx = 0; const auto& val : vec) {
+        std::cout << idx++ << ": " << val << "\n";
+    }
+
+    // if with initializer (C++17)
+    if (auto it = std::find(vec.begin(), vec.end(), 3); it != vec.end()) {
+        std::cout << "Found 3 in modified vec\n";
+    }
+
+    // if constexpr (C++17)
+    auto getValue = [](auto t) {
+        if constexpr (std::is_pointer_v<decltype(t)>) {
+            return *t;
+        } else {
+            return t;
+        }
+    };
+    int x = 10;
+    int* px = &x;
     std::cout << "getValue(x): " << getValue(x) << "\n";
     std::cout << "getValue(px): " << getValue(px) << "\n";
+    std::cout << "value_dispatch(px): " << value_dispatch(px) << "\n";
 
     // if consteval (C++23)
     constexpr auto ipow = [&](auto base, auto exp) {
@@ -335,6 +1373,12 @@ void test_control_flow() {
     constexpr long long ipow_result = ipow(2, 10); // compile-time
     std::cout << "ipow(2,10) compile-time: " << ipow_result << "\n";
 
+    // constinit lookup tables built by consteval generators
+    std::cout << "pow_table<2, 63>[62]: " << pow_table<2, 63>[62] << "\n";
+    std::cout << "factorial_table[12]: " << factorial_table[12] << "\n";
+    std::cout << "binomial_table<10>[9][4]: " << binomial_table<10>[9][4] << "\n";
+    std::cout << "sin_q15(30): " << sin_q15(30) << ", cos_q15(60): " << cos_q15(60) << "\n";
+
     // switch with initializer (C++17)
     enum class Status { Init, Running };
     auto getStatus = []() { return Status::Running; };
@@ -352,6 +1396,114 @@ void test_control_flow() {
 // Lambdas
 // =============================
 
+// Templated lambda (C++20)
+// Lives at namespace scope so the benchmarks can time both branches
+inline constexpr auto Pow = [](auto base, auto exponent) {
+    if constexpr (std::is_integral_v<decltype(base)>) {
+        long long result = 1;
+        auto b = base;
+        auto e = exponent;
+        while (e) {
+            if (e & 1) result *= b;
+            e >>= 1;
+            b *= b;
+        }
+        return result;
+    } else if constexpr (std::is_same_v<decltype(base), float>) {
+        return std::powf(base, exponent);
+    } else {
+        return std::pow(static_cast<double>(base), static_cast<double>(exponent));
+    }
+};
+
+// Pow's branches as a dispatch table, for batches of bases
+inline constexpr TypeDispatch pow_dispatch{
+    rule<std::is_integral>([](auto base, auto exponent) { return Pow(base, exponent); }),
+    rule<IsFloat>([](float base, auto exponent) { return std::pow(base, static_cast<float>(exponent)); }),
+    rule<AnyType>([](auto base, auto exponent) { return std::pow(static_cast<double>(base), static_cast<double>(exponent)); }),
+};
+
+// Inline function wrapper (type erasure without the heap)
+// Move-only replacement for std::function that stores the callable in a fixed
+// in-object buffer: callables that do not fit are rejected at compile time
+// instead of being heap-allocated. Dispatch goes through a static table of
+// function pointers, so no RTTI is needed.
+template<typename Signature, size_t Capacity = 32>
+class InplaceFunction;
+
+template<typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    InplaceFunction() noexcept = default;
+
+    template<typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction> && std::is_invocable_r_v<R, F&, Args...>)
+    InplaceFunction(F&& f) {
+        using Fn = std::remove_cvref_t<F>;
+        static_assert(sizeof(Fn) <= Capacity, "Callable does not fit in InplaceFunction; raise Capacity");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t));
+        static_assert(std::is_nothrow_move_constructible_v<Fn>);
+        ::new (static_cast<void*>(m_storage)) Fn(std::forward<F>(f));
+        m_ops = &kOps<Fn>;
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept { take(other); }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() { reset(); }
+
+    // Like std::function, calling an empty or moved-from wrapper throws
+    R operator()(Args... args) {
+        if (m_ops == nullptr) throw std::bad_function_call();
+        return m_ops->invoke(m_storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return m_ops != nullptr; }
+
+private:
+    struct Ops {
+        R    (*invoke)(void*, Args&&...);
+        void (*relocate)(void* dst, void* src) noexcept;   // move-construct into dst, destroy src
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename Fn>
+    static constexpr Ops kOps {
+        [](void* self, Args&&... args) -> R { return std::invoke(*static_cast<Fn*>(self), std::forward<Args>(args)...); },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        },
+        [](void* self) noexcept { static_cast<Fn*>(self)->~Fn(); },
+    };
+
+    void take(InplaceFunction& other) noexcept {
+        if (other.m_ops != nullptr) {
+            other.m_ops->relocate(m_storage, other.m_storage);
+            m_ops = std::exchange(other.m_ops, nullptr);
+        }
+    }
+
+    void reset() noexcept {
+        if (m_ops != nullptr) {
+            std::exchange(m_ops, nullptr)->destroy(m_storage);
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[Capacity];
+    const Ops* m_ops = nullptr;
+};
+
 void test_lambdas() {
     int foo = 5;
 
@@ -384,6 +1536,10 @@ void test_lambdas() {
     auto adder = make_adder(7);
     std::cout << "adder(3): " << adder(3) << "\n";
 
+    // Storing closures without heap allocation
+    InplaceFunction<int(int)> callbacks[] = { make_adder(7), std::move(lambda4) };
+    std::cout << "InplaceFunction adder(3): " << callbacks[0](3) << ", lambda4(2): " << callbacks[1](2) << "\n";
+
     // Capture of *this (C++17)
     struct Cls {
         int value;
@@ -400,26 +1556,14 @@ void test_lambdas() {
     constexpr auto add_constexpr_lambda = [](auto a, auto b) { return a + b; };
     static_assert(add_constexpr_lambda(2, 3) == 5);
 
-    // Templated lambda (C++20)
-    auto Pow = [](auto base, auto exponent) {
-        if constexpr (std::is_integral_v<decltype(base)>) {
-            long long result = 1;
-            auto b = base;
-            auto e = exponent;
-            while (e) {
-                if (e & 1) result *= b;
-                e >>= 1;
-                b *= b;
-            }
-            return result;
-        } else if constexpr (std::is_same_v<decltype(base), float>) {
-            return std::powf(base, exponent);
-        } else {
-            return std::pow(static_cast<double>(base), static_cast<double>(exponent));
-        }
-    };
+    // Templated lambda (C++20): see Pow above
     std::cout << "Pow(2, 8): " << Pow(2, 8) << "\n";
     std::cout << "Pow(2.0f, 3): " << Pow(2.0f, 3) << "\n";
+
+    std::vector<int>       bases = {1, 2, 3, 4};
+    std::vector<long long> cubes(bases.size());
+    pow_dispatch.apply_batch(bases, cubes, 3); // integral kernel picked once for the batch
+    std::cout << "pow_dispatch cubes: " << cubes[0] << " " << cubes[1] << " " << cubes[2] << " " << cubes[3] << "\n";
 }
 
 // =============================
@@ -429,269 +1573,2458 @@ void test_lambdas() {
 // Attributes (C++11 onward)
 [[nodiscard]] int must_use() { return 42; }
 
-void test_other_parts() {
-    // Rvalue references (C++11)
-    int a = 3, b = 4;
-    int&& rv = a + b; // binds to rvalue (7)
-    std::cout << "rvalue reference: " << rv << "\n";
+// Work-stealing thread pool (std::thread, std::atomic and thread_local)
+// Every worker owns a Chase-Lev deque: it pushes and pops its own tasks at the
+// bottom while idle workers steal from the top with a CAS. The worker a thread
+// belongs to is found through thread_local storage. parallel_for splits its
+// range recursively (fork) and helps run other tasks until its halves finish (join).
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(unsigned workers = std::max(1u, std::thread::hardware_concurrency())) {
+        for (unsigned i = 0; i < workers; ++i) {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+        for (unsigned i = 0; i < workers; ++i) {
+            m_threads.emplace_back([this, i] { worker_main(i); });
+        }
+    }
 
-    // Static assertions (C++11)
-    static_assert(sizeof(void*) == sizeof(std::uintptr_t), "Pointer size mismatch");
+    ~WorkStealingPool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
 
-    // sizeof on class member (C++11)
-    struct A { double data; };
-    std::cout << "Size of A::data: " << sizeof(A::data) << "\n";
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    size_t size() const { return m_workers.size(); }
+
+    // Calls f(first, last) on disjoint sub-ranges of at most grain elements
+    template<typename F>
+    void parallel_for(size_t begin, size_t end, size_t grain, F f) {
+        if (begin >= end) return;
+        grain = std::max<size_t>(grain, 1);
+        if (Worker* self = current_worker()) {
+            split(*self, begin, end, grain, f);
+            return;
+        }
+        // Called from outside the pool: hand the whole range to the workers and wait
+        RangeTask<F> root(this, begin, end, grain, f);
+        root.external = true;
+        {
+            std::unique_lock lock(m_mutex);
+            m_injected.push_back(&root);
+            m_has_injected.store(true, std::memory_order_release);
+            m_wake.notify_one();
+            m_done.wait(lock, [&root] { return root.done.load(std::memory_order_acquire); });
+        }
+    }
 
-    // alignof and alignas (C++11)
-    struct alignas(16) Vec4 {
-        float x, y, z, w;
+private:
+    struct Task {
+        void (*run)(Task*);
+        bool              external = false;
+        std::atomic<bool> done{false};
     };
-    static_assert(alignof(Vec4) == 16);
-    alignas(float) unsigned char matrix[sizeof(float) * 16];
 
-    // Thread-local storage (C++11)
-    thread_local int tls_counter = 0;
-    tls_counter += 1;
-    std::cout << "Thread-local counter: " << tls_counter << "\n";
+    // Bounded Chase-Lev deque; push fails when full and the caller runs the task inline
+    class StealDeque {
+    public:
+        bool push(Task* task) {
+            int64_t b = m_bottom.load(std::memory_order_relaxed);
+            int64_t t = m_top.load(std::memory_order_acquire);
+            if (b - t >= static_cast<int64_t>(kCapacity)) return false;
+            m_buffer[b & kMask].store(task, std::memory_order_relaxed);
+            m_bottom.store(b + 1, std::memory_order_seq_cst);
+            return true;
+        }
 
-    int result = must_use();
-    (void)result; // avoid unused warning
-}
+        Task* pop() {
+            int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(b, std::memory_order_seq_cst);
+            int64_t t = m_top.load(std::memory_order_seq_cst);
+            if (t > b) {
+                m_bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            Task* task = m_buffer[b & kMask].load(std::memory_order_relaxed);
+            if (t == b) {
+                // Last task: race the thieves for it
+                if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    task = nullptr;
+                }
+                m_bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return task;
+        }
 
-// =============================
-// Object-Oriented
-// =============================
+        Task* steal() {
+            int64_t t = m_top.load(std::memory_order_seq_cst);
+            int64_t b = m_bottom.load(std::memory_order_seq_cst);
+            if (t >= b) return nullptr;
+            Task* task = m_buffer[t & kMask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return task;
+        }
 
-// In-class member initializer (C++11)
-struct InClassInit {
-    int value = 100;
-};
+    private:
+        static constexpr size_t kCapacity = 1024;
+        static constexpr size_t kMask     = kCapacity - 1;
 
-// Inline static member initialization (C++17)
-struct InlineStaticInit {
-    static inline int static_val = 200;
-};
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+        std::array<std::atomic<Task*>, kCapacity> m_buffer{};
+    };
 
-// Delegating constructors (C++11)
-struct Delegating {
-    int value;
-    Delegating() : Delegating(-1) {} // delegates to Delegating(int)
-    Delegating(int v) : value(v) {}
-};
+    struct Worker {
+        StealDeque deque;
+        unsigned   index = 0;
+        WorkStealingPool* pool = nullptr;
+    };
 
-// Inherited constructors (C++11)
-struct BaseCtor {
-    int value;
-    BaseCtor() : value(0) {}
-    BaseCtor(int v) : value(v) {}
-};
+    template<typename F>
+    struct RangeTask : Task {
+        WorkStealingPool* pool;
+        size_t begin, end, grain;
+        F&     f;
 
-struct InheritedCtor : public BaseCtor {
-    using BaseCtor::BaseCtor; // inherit constructors
+        RangeTask(WorkStealingPool* p, size_t b, size_t e, size_t g, F& fn)
+            : Task{&RangeTask::execute}, pool(p), begin(b), end(e), grain(g), f(fn) {}
+
+        static void execute(Task* task) {
+            auto* self = static_cast<RangeTask*>(task);
+            self->pool->split(*self->pool->current_worker(), self->begin, self->end, self->grain, self->f);
+        }
+    };
+
+    static inline thread_local Worker* t_worker = nullptr;
+
+    Worker* current_worker() const {
+        return t_worker != nullptr && t_worker->pool == this ? t_worker : nullptr;
+    }
+
+    template<typename F>
+    void split(Worker& self, size_t begin, size_t end, size_t grain, F& f) {
+        if (end - begin <= grain) {
+            f(begin, end);
+            return;
+        }
+        size_t mid = begin + (end - begin) / 2;
+        RangeTask<F> right(this, mid, end, grain, f);
+        if (!self.deque.push(&right)) {
+            split(self, begin, mid, grain, f);
+            split(self, mid, end, grain, f);
+            return;
+        }
+        split(self, begin, mid, grain, f);
+        // Join: run whatever is available (usually `right` itself) until it is done
+        while (!right.done.load(std::memory_order_acquire)) {
+            if (Task* task = find_task(self)) {
+                execute(task);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void execute(Task* task) {
+        task->run(task);
+        if (task->external) {
+            {
+                std::lock_guard lock(m_mutex);
+                task->done.store(true, std::memory_order_release);
+            }
+            m_done.notify_all();
+        } else {
+            task->done.store(true, std::memory_order_release);
+        }
+    }
+
+    Task* find_task(Worker& self) {
+        if (Task* task = self.deque.pop()) return task;
+        for (size_t i = 1; i < m_workers.size(); ++i) {
+            if (Task* task = m_workers[(self.index + i) % m_workers.size()]->deque.steal()) return task;
+        }
+        if (m_has_injected.load(std::memory_order_acquire)) {
+            std::lock_guard lock(m_mutex);
+            if (!m_injected.empty()) {
+                Task* task = m_injected.front();
+                m_injected.pop_front();
+                m_has_injected.store(!m_injected.empty(), std::memory_order_release);
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    void worker_main(unsigned index) {
+        Worker& self = *m_workers[index];
+        self.index = index;
+        self.pool  = this;
+        t_worker   = &self;
+
+        for (unsigned idle = 0;;) {
+            if (Task* task = find_task(self)) {
+                execute(task);
+                idle = 0;
+                continue;
+            }
+            if (++idle < 64) {
+                std::this_thread::yield();
+                continue;
+            }
+            // Nothing to run or steal: sleep until new work is injected
+            std::unique_lock lock(m_mutex);
+            if (m_stop) break;
+            m_wake.wait_for(lock, std::chrono::milliseconds(1), [this] { return m_stop || !m_injected.empty(); });
+        }
+        t_worker = nullptr;
+    }
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread>             m_threads;
+    std::mutex                           m_mutex;   // guards m_injected and m_stop
+    std::condition_variable              m_wake;
+    std::condition_variable              m_done;
+    std::deque<Task*>                    m_injected;
+    std::atomic<bool>                    m_has_injected{false};
+    bool                                 m_stop = false;
 };
 
-// Move constructor (C++11)
-class ClsMove {
-public:
-    int* ptr;
-    ClsMove() { ptr = new int(0); }
-    ClsMove(const ClsMove& other) { ptr = new int(*other.ptr); }
-    ClsMove(ClsMove&& other) noexcept { ptr = other.ptr; other.ptr = nullptr; }
-    ~ClsMove() { delete ptr; }
+inline WorkStealingPool& default_pool() {
+    static WorkStealingPool pool;
+    return pool;
+}
+
+// Vec4 / Mat4 math (alignas)
+// Kernels use SSE, plus AVX for batched transforms, when the target supports
+// them and fall back to scalar code otherwise. Mat4 is column-major.
+struct alignas(16) Vec4 {
+    float x, y, z, w;
 };
 
-// Explicit conversion operators (C++11)
-struct BoolWrapper {
-    bool value;
-    explicit BoolWrapper(bool v) : value(v) {}
-    explicit operator bool() const { return value; }
-    explicit operator std::string() const { return value ? "true" : "false"; }
+struct alignas(16) Mat4 {
+    Vec4 cols[4];
+
+    static constexpr Mat4 identity() {
+        return {{ {1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1} }};
+    }
 };
 
-// Explicit virtual function override (C++11)
-struct BaseVirtual {
-    virtual void foo() { std::cout << "BaseVirtual::foo\n"; }
-    virtual void bar() { std::cout << "BaseVirtual::bar\n"; }
+#if SIMD_SSE
+inline __m128 to_m128(const Vec4& v) { return _mm_load_ps(&v.x); }
+inline Vec4   to_vec4(__m128 r)      { Vec4 v; _mm_store_ps(&v.x, r); return v; }
+
+// Splats lane N of v into all four lanes
+template<int N>
+inline __m128 splat(__m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(N, N, N, N)); }
+#endif
+
+inline Vec4 operator+(const Vec4& a, const Vec4& b) {
+#if SIMD_SSE
+    return to_vec4(_mm_add_ps(to_m128(a), to_m128(b)));
+#else
+    return {a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w};
+#endif
+}
+
+inline Vec4 operator*(const Vec4& a, float s) {
+#if SIMD_SSE
+    return to_vec4(_mm_mul_ps(to_m128(a), _mm_set1_ps(s)));
+#else
+    return {a.x * s, a.y * s, a.z * s, a.w * s};
+#endif
+}
+
+inline float dot(const Vec4& a, const Vec4& b) {
+#if SIMD_SSE
+    __m128 m    = _mm_mul_ps(to_m128(a), to_m128(b));
+    __m128 shuf = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(m, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+#else
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+#endif
+}
+
+// Cross product of the xyz parts; w is 0
+inline Vec4 cross(const Vec4& a, const Vec4& b) {
+#if SIMD_SSE
+    __m128 va = to_m128(a), vb = to_m128(b);
+    __m128 a_yzx = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 b_yzx = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 c     = _mm_sub_ps(_mm_mul_ps(va, b_yzx), _mm_mul_ps(a_yzx, vb));
+    return to_vec4(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+#else
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x, 0.0f};
+#endif
+}
+
+inline Vec4 operator*(const Mat4& m, const Vec4& v) {
+#if SIMD_SSE
+    __m128 r = to_m128(v);
+    __m128 result = _mm_mul_ps(to_m128(m.cols[0]), splat<0>(r));
+    result = _mm_add_ps(result, _mm_mul_ps(to_m128(m.cols[1]), splat<1>(r)));
+    result = _mm_add_ps(result, _mm_mul_ps(to_m128(m.cols[2]), splat<2>(r)));
+    result = _mm_add_ps(result, _mm_mul_ps(to_m128(m.cols[3]), splat<3>(r)));
+    return to_vec4(result);
+#else
+    return m.cols[0] * v.x + m.cols[1] * v.y + m.cols[2] * v.z + m.cols[3] * v.w;
+#endif
+}
+
+inline Mat4 operator*(const Mat4& a, const Mat4& b) {
+    Mat4 result;
+    for (int c = 0; c < 4; ++c) {
+        result.cols[c] = a * b.cols[c];
+    }
+    return result;
+}
+
+// out[i] = m * in[i]; AVX handles two vectors per instruction
+inline void transform(const Mat4& m, std::span<const Vec4> in, std::span<Vec4> out) {
+    assert(out.size() >= in.size());
+    size_t i = 0;
+#if SIMD_AVX
+    const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m.cols[0]));
+    const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m.cols[1]));
+    const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m.cols[2]));
+    const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m.cols[3]));
+    for (; i + 2 <= in.size(); i += 2) {
+        __m256 v = _mm256_loadu_ps(&in[i].x);
+        __m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c2, _mm256_permute_ps(v, 0xAA)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF)));
+        _mm256_storeu_ps(&out[i].x, r);
+    }
+#endif
+    for (; i < in.size(); ++i) {
+        out[i] = m * in[i];
+    }
+}
+
+// Complex arrays and FFT (std::complex)
+// Interleaved layout stores re, im pairs exactly like std::complex<T>[]; split
+// layout keeps the real parts and the imaginary parts in two arrays, so every
+// SIMD lane does the same work. The kernels write out the complex product
+// instead of using std::complex's operator*, which goes through a library
+// call to get inf/NaN cases right.
+enum class ComplexLayout { Interleaved, Split };
+
+#if SIMD_SSE
+// Interleaved complex values in SSE registers: two complex<float> per __m128,
+// one complex<double> per __m128d
+template<typename T> struct ComplexLanes;
+
+template<> struct ComplexLanes<float> {
+    using Reg = __m128;
+    static constexpr size_t kScalars = 4;
+    static Reg  load(const float* p)   { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm_storeu_ps(p, r); }
+    static Reg  add(Reg a, Reg b)      { return _mm_add_ps(a, b); }
+    static Reg  sub(Reg a, Reg b)      { return _mm_sub_ps(a, b); }
+    static Reg  mul(Reg a, Reg b)      { return _mm_mul_ps(a, b); }
+    static Reg  negate(Reg a)          { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+    static Reg  negate_real(Reg a)     { return _mm_xor_ps(a, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f)); }
+    static Reg  negate_imag(Reg a)     { return _mm_xor_ps(a, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f)); }
+    static Reg  swap_parts(Reg a)      { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+    static Reg  dup_real(Reg a)        { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0)); }
+    static Reg  dup_imag(Reg a)        { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1)); }
 };
 
-struct DerivedVirtual : public BaseVirtual {
-    void foo(int) { std::cout << "DerivedVirtual::foo(int)\n"; }
-    void foo() const { std::cout << "DerivedVirtual::foo() const\n"; } // does not override
-    void bar() override { std::cout << "DerivedVirtual::bar\n"; }     // overrides
+template<> struct ComplexLanes<double> {
+    using Reg = __m128d;
+    static constexpr size_t kScalars = 2;
+    static Reg  load(const double* p)   { return _mm_loadu_pd(p); }
+    static void store(double* p, Reg r) { _mm_storeu_pd(p, r); }
+    static Reg  add(Reg a, Reg b)       { return _mm_add_pd(a, b); }
+    static Reg  sub(Reg a, Reg b)       { return _mm_sub_pd(a, b); }
+    static Reg  mul(Reg a, Reg b)       { return _mm_mul_pd(a, b); }
+    static Reg  negate(Reg a)           { return _mm_xor_pd(a, _mm_set1_pd(-0.0)); }
+    static Reg  negate_real(Reg a)      { return _mm_xor_pd(a, _mm_set_pd(0.0, -0.0)); }
+    static Reg  negate_imag(Reg a)      { return _mm_xor_pd(a, _mm_set_pd(-0.0, 0.0)); }
+    static Reg  swap_parts(Reg a)       { return _mm_shuffle_pd(a, a, 1); }
+    static Reg  dup_real(Reg a)         { return _mm_unpacklo_pd(a, a); }
+    static Reg  dup_imag(Reg a)         { return _mm_unpackhi_pd(a, a); }
 };
 
-// final (C++11)
-struct FinalClass final {
-    void display() { std::cout << "This is a final class\n"; }
-};
+// (a.re * b.re - a.im * b.im, a.im * b.re + a.re * b.im) in every complex lane
+template<typename T>
+inline typename ComplexLanes<T>::Reg complex_mul_lanes(typename ComplexLanes<T>::Reg a, typename ComplexLanes<T>::Reg b) {
+    using S = ComplexLanes<T>;
+    return S::add(S::mul(a, S::dup_real(b)), S::negate_real(S::mul(S::swap_parts(a), S::dup_imag(b))));
+}
+#endif
+
+template<typename T>
+inline std::complex<T> complex_mul(std::complex<T> a, std::complex<T> b) {
+    return {a.real() * b.real() - a.imag() * b.imag(), a.imag() * b.real() + a.real() * b.imag()};
+}
+
+// out[i] = a[i] + b[i] over `count` scalars; works for either layout
+template<typename T>
+void add_scalars(const T* a, const T* b, T* out, size_t count) {
+    size_t i = 0;
+#if SIMD_SSE
+    using S = ComplexLanes<T>;
+    for (; i + S::kScalars <= count; i += S::kScalars) S::store(out + i, S::add(S::load(a + i), S::load(b + i)));
+#endif
+    for (; i < count; ++i) out[i] = a[i] + b[i];
+}
+
+// data[i] = -data[i] over `count` scalars (conjugate of a split array's imaginary parts)
+template<typename T>
+void negate_scalars(T* data, size_t count) {
+    size_t i = 0;
+#if SIMD_SSE
+    using S = ComplexLanes<T>;
+    for (; i + S::kScalars <= count; i += S::kScalars) S::store(data + i, S::negate(S::load(data + i)));
+#endif
+    for (; i < count; ++i) data[i] = -data[i];
+}
+
+// Complex conjugate of n interleaved values
+template<typename T>
+void conj_interleaved(T* data, size_t n) {
+    size_t i = 0;
+#if SIMD_SSE
+    using S = ComplexLanes<T>;
+    for (; i + S::kScalars <= 2 * n; i += S::kScalars) S::store(data + i, S::negate_imag(S::load(data + i)));
+#endif
+    for (; i < 2 * n; i += 2) data[i + 1] = -data[i + 1];
+}
+
+// out = a * b for n interleaved values; out may alias a or b
+template<typename T>
+void complex_mul_interleaved(const T* a, const T* b, T* out, size_t n) {
+    size_t i = 0;
+#if SIMD_SSE
+    using S = ComplexLanes<T>;
+    for (; i + S::kScalars <= 2 * n; i += S::kScalars) S::store(out + i, complex_mul_lanes<T>(S::load(a + i), S::load(b + i)));
+#endif
+    for (; i < 2 * n; i += 2) {
+        T re = a[i] * b[i] - a[i + 1] * b[i + 1];
+        T im = a[i + 1] * b[i] + a[i] * b[i + 1];
+        out[i]     = re;
+        out[i + 1] = im;
+    }
+}
+
+// out = a * b for n split values; outputs may alias the inputs
+template<typename T>
+void complex_mul_split(const T* a_re, const T* a_im, const T* b_re, const T* b_im, T* out_re, T* out_im, size_t n) {
+    size_t i = 0;
+#if SIMD_SSE
+    using S = ComplexLanes<T>;
+    for (; i + S::kScalars <= n; i += S::kScalars) {
+        auto ar = S::load(a_re + i), ai = S::load(a_im + i);
+        auto br = S::load(b_re + i), bi = S::load(b_im + i);
+        S::store(out_re + i, S::sub(S::mul(ar, br), S::mul(ai, bi)));
+        S::store(out_im + i, S::add(S::mul(ar, bi), S::mul(ai, br)));
+    }
+#endif
+    for (; i < n; ++i) {
+        T re = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+        T im = a_re[i] * b_im[i] + a_im[i] * b_re[i];
+        out_re[i] = re;
+        out_im[i] = im;
+    }
+}
+
+template<typename T, ComplexLayout L = ComplexLayout::Interleaved>
+class ComplexArray {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "ComplexArray holds float or double parts");
+    static constexpr bool kSplit = L == ComplexLayout::Split;
+
+public:
+    explicit ComplexArray(size_t n = 0) : m_values(kSplit ? 0 : n), m_real(kSplit ? n : 0), m_imag(kSplit ? n : 0) {}
+
+    size_t size() const { return kSplit ? m_real.size() : m_values.size(); }
+
+    std::complex<T> operator[](size_t i) const {
+        if constexpr (kSplit) return {m_real[i], m_imag[i]};
+        else return m_values[i];
+    }
+
+    void set(size_t i, std::complex<T> value) {
+        if constexpr (kSplit) {
+            m_real[i] = value.real();
+            m_imag[i] = value.imag();
+        } else {
+            m_values[i] = value;
+        }
+    }
+
+    // Interleaved storage, e.g. for Fft
+    std::span<std::complex<T>> values() requires (!kSplit) { return m_values; }
+
+    std::span<T> real() requires kSplit { return m_real; }
+    std::span<T> imag() requires kSplit { return m_imag; }
+
+    ComplexArray& operator+=(const ComplexArray& other) {
+        check_same_size(other);
+        if constexpr (kSplit) {
+            add_scalars(m_real.data(), other.m_real.data(), m_real.data(), size());
+            add_scalars(m_imag.data(), other.m_imag.data(), m_imag.data(), size());
+        } else {
+            add_scalars(scalars(), other.scalars(), scalars(), 2 * size());
+        }
+        return *this;
+    }
+
+    ComplexArray& operator*=(const ComplexArray& other) {
+        check_same_size(other);
+        if constexpr (kSplit) {
+            complex_mul_split(m_real.data(), m_imag.data(), other.m_real.data(), other.m_imag.data(), m_real.data(), m_imag.data(), size());
+        } else {
+            complex_mul_interleaved(scalars(), other.scalars(), scalars(), size());
+        }
+        return *this;
+    }
+
+    ComplexArray& conjugate() {
+        if constexpr (kSplit) negate_scalars(m_imag.data(), size());
+        else conj_interleaved(scalars(), size());
+        return *this;
+    }
+
+private:
+    void check_same_size(const ComplexArray& other) const {
+        if (size() != other.size()) throw std::invalid_argument("ComplexArray: operand sizes differ");
+    }
+
+    // std::complex<T>[] may be accessed as T[2 * n] ([complex.numbers.general])
+    T*       scalars()       { return reinterpret_cast<T*>(m_values.data()); }
+    const T* scalars() const { return reinterpret_cast<const T*>(m_values.data()); }
+
+    std::vector<std::complex<T>> m_values; // interleaved layout
+    std::vector<T>               m_real;   // split layout
+    std::vector<T>               m_imag;
+};
+
+// In-place FFT of a power-of-two size over interleaved std::complex<T>.
+// Decimation in time: a bit-reversal permutation, one radix-2 pass when
+// log2(n) is odd, then radix-4 passes that each do the work of two radix-2
+// stages in a single sweep over the data. Each pass stores its twiddles
+// contiguously so the butterflies run on whole SIMD registers.
+template<typename T>
+class Fft {
+public:
+    explicit Fft(size_t n) : m_size(n), m_bitrev(n) {
+        if (!std::has_single_bit(n)) throw std::invalid_argument("Fft: size must be a power of two");
+        unsigned bits = static_cast<unsigned>(std::countr_zero(n));
+        for (size_t i = 0; i < n; ++i) {
+            m_bitrev[i] = bits == 0 ? 0 : static_cast<uint32_t>(bit_reverse(i) >> (64 - bits));
+        }
+        // Per radix-4 pass over sub-transforms of size m: w_4m^j, then w_2m^j = (w_4m^j)^2, for j < m
+        for (size_t m = (bits % 2) ? 2 : 1; m < n; m *= 4) {
+            for (int square = 0; square < 2; ++square) {
+                for (size_t j = 0; j < m; ++j) {
+                    double angle = -2.0 * std::numbers::pi * static_cast<double>(j) / static_cast<double>((square ? 2 : 4) * m);
+                    m_twiddles.emplace_back(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+                }
+            }
+        }
+    }
+
+    size_t size() const { return m_size; }
+
+    // X[k] = sum x[j] * e^(-2*pi*i*j*k/n)
+    void forward(std::span<std::complex<T>> data) const {
+        check_size(data);
+        for (size_t i = 0; i < m_size; ++i) {
+            if (i < m_bitrev[i]) std::swap(data[i], data[m_bitrev[i]]);
+        }
+
+        size_t m = 1;
+        if (std::countr_zero(m_size) % 2) {
+            for (size_t i = 0; i < m_size; i += 2) {
+                std::complex<T> a = data[i], b = data[i + 1];
+                data[i]     = a + b;
+                data[i + 1] = a - b;
+            }
+            m = 2;
+        }
+
+        const std::complex<T>* twiddles = m_twiddles.data();
+        for (; m < m_size; m *= 4) {
+            for (size_t block = 0; block < m_size; block += 4 * m) {
+                radix4(data.data() + block, twiddles, twiddles + m, m);
+            }
+            twiddles += 2 * m;
+        }
+    }
+
+    // Inverse transform, scaled by 1/n: conj(forward(conj(x))) / n
+    void inverse(std::span<std::complex<T>> data) const {
+        check_size(data);   // before the data is conjugated in place
+        T* scalars = reinterpret_cast<T*>(data.data());
+        conj_interleaved(scalars, data.size());
+        forward(data);
+        conj_interleaved(scalars, data.size());
+        const T scale = T(1) / static_cast<T>(m_size);
+        for (auto& value : data) value *= scale;
+    }
+
+private:
+    void check_size(std::span<const std::complex<T>> data) const {
+        if (data.size() != m_size) throw std::invalid_argument("Fft: data size does not match the transform size");
+    }
+
+    static uint64_t bit_reverse(uint64_t v) {
+        v = ((v >> 1) & 0x5555555555555555ull) | ((v & 0x5555555555555555ull) << 1);
+        v = ((v >> 2) & 0x3333333333333333ull) | ((v & 0x3333333333333333ull) << 2);
+        v = ((v >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((v & 0x0F0F0F0F0F0F0F0Full) << 4);
+        return std::byteswap(v);
+    }
+
+    // Combines four consecutive size-m transforms into one of size 4m.
+    // w4[j] = w_4m^j and w2[j] = w_2m^j; the w_4m^(j+m) twiddle is w4[j] * -i.
+    static void radix4(std::complex<T>* x, const std::complex<T>* w4, const std::complex<T>* w2, size_t m) {
+        size_t j = 0;
+#if SIMD_SSE
+        using S = ComplexLanes<T>;
+        constexpr size_t kPerReg = S::kScalars / 2;
+        for (; j + kPerReg <= m; j += kPerReg) {
+            T* p[4] = {reinterpret_cast<T*>(x + j), reinterpret_cast<T*>(x + j + m), reinterpret_cast<T*>(x + j + 2 * m), reinterpret_cast<T*>(x + j + 3 * m)};
+            auto t4 = S::load(reinterpret_cast<const T*>(w4 + j));
+            auto t2 = S::load(reinterpret_cast<const T*>(w2 + j));
+            auto a = S::load(p[0]);
+            auto b = complex_mul_lanes<T>(S::load(p[1]), t2);
+            auto c = S::load(p[2]);
+            auto d = complex_mul_lanes<T>(S::load(p[3]), t2);
+            auto a1 = S::add(a, b), b1 = S::sub(a, b);
+            auto c1 = complex_mul_lanes<T>(S::add(c, d), t4);
+            auto d1 = S::negate_imag(S::swap_parts(complex_mul_lanes<T>(S::sub(c, d), t4))); // * -i
+            S::store(p[0], S::add(a1, c1));
+            S::store(p[1], S::add(b1, d1));
+            S::store(p[2], S::sub(a1, c1));
+            S::store(p[3], S::sub(b1, d1));
+        }
+#endif
+        for (; j < m; ++j) {
+            std::complex<T> a = x[j];
+            std::complex<T> b = complex_mul(x[j + m], w2[j]);
+            std::complex<T> c = x[j + 2 * m];
+            std::complex<T> d = complex_mul(x[j + 3 * m], w2[j]);
+            std::complex<T> a1 = a + b, b1 = a - b;
+            std::complex<T> c1 = complex_mul(c + d, w4[j]);
+            std::complex<T> cd = complex_mul(c - d, w4[j]);
+            std::complex<T> d1(cd.imag(), -cd.real()); // * -i
+            x[j]         = a1 + c1;
+            x[j + m]     = b1 + d1;
+            x[j + 2 * m] = a1 - c1;
+            x[j + 3 * m] = b1 - d1;
+        }
+    }
+
+    size_t                       m_size;
+    std::vector<uint32_t>        m_bitrev;
+    std::vector<std::complex<T>> m_twiddles;
+};
+
+// Small per-thread number handed out round-robin, used to pick per-thread shards.
+// The thread_local is constant-initialized, so reading it needs no TLS guard.
+inline size_t thread_shard_index() {
+    constexpr size_t kUnassigned = ~size_t{0};
+    static constinit std::atomic<size_t> next{0};
+    static constinit thread_local size_t index = kUnassigned;
+    if (index == kUnassigned) [[unlikely]] {
+        index = next.fetch_add(1, std::memory_order_relaxed);
+    }
+    return index;
+}
+
+// Sharded counter (thread_local + alignas)
+// Each thread increments its own cache-line-sized shard, so a hot counter no
+// longer bounces one cache line between cores; value() sums the shards.
+class ShardedCounter {
+public:
+    static constexpr size_t kShards = 64;
+
+    void add(int64_t delta = 1) {
+        m_shards[thread_shard_index() % kShards].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    int64_t value() const {
+        int64_t total = 0;
+        for (const auto& shard : m_shards) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset() {
+        for (auto& shard : m_shards) {
+            shard.value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<int64_t> value{0};
+    };
+
+    std::array<Shard, kShards> m_shards{};
+};
+
+// Scoped latency tracing (std::chrono)
+// LatencyHistogram uses HDR-style log-linear buckets: 64 linear sub-buckets per
+// power of two, so any recorded value is within 1.6% of its bucket. Each thread
+// records into its own lazily allocated shard; reads merge the shards.
+class LatencyHistogram {
+public:
+    static constexpr int    kSubBits  = 6;
+    static constexpr size_t kSub      = size_t{1} << kSubBits;
+    static constexpr int    kMaxBits  = 40;   // values up to 2^40 ns (~18 minutes)
+    static constexpr size_t kBuckets  = (kMaxBits - kSubBits + 1) * kSub;
+    static constexpr size_t kShards   = 16;
+
+    LatencyHistogram() = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    ~LatencyHistogram() {
+        for (auto& shard : m_shards) {
+            delete shard.load(std::memory_order_relaxed);
+        }
+    }
+
+    void record(std::chrono::nanoseconds elapsed) {
+        uint64_t ns = static_cast<uint64_t>(std::max<int64_t>(elapsed.count(), 0));
+        local_shard().counts[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Merged view of all shards; percentile values are bucket upper bounds
+    struct Snapshot {
+        std::vector<uint64_t> counts;
+        uint64_t              total = 0;
+
+        std::chrono::nanoseconds percentile(double p) const {
+            if (total == 0) return std::chrono::nanoseconds{0};
+            uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * static_cast<double>(total))));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < counts.size(); ++i) {
+                seen += counts[i];
+                if (seen >= rank) return std::chrono::nanoseconds(upper_bound_of(i));
+            }
+            return std::chrono::nanoseconds(upper_bound_of(counts.size() - 1));
+        }
+    };
+
+    Snapshot snapshot() const {
+        Snapshot merged{std::vector<uint64_t>(kBuckets), 0};
+        for (const auto& slot : m_shards) {
+            if (const Shard* shard = slot.load(std::memory_order_acquire)) {
+                for (size_t i = 0; i < kBuckets; ++i) {
+                    merged.counts[i] += shard->counts[i].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        for (uint64_t c : merged.counts) merged.total += c;
+        return merged;
+    }
+
+    void report(std::ostream& os, std::string_view name) const {
+        Snapshot s = snapshot();
+        os << name << ": count=" << s.total
+           << " p50=" << s.percentile(0.50).count() << "ns"
+           << " p99=" << s.percentile(0.99).count() << "ns"
+           << " p999=" << s.percentile(0.999).count() << "ns"
+           << " max=" << s.percentile(1.0).count() << "ns\n";
+    }
+
+    static constexpr size_t bucket_of(uint64_t ns) {
+        ns = std::min(ns, (uint64_t{1} << kMaxBits) - 1);
+        if (ns < kSub) return static_cast<size_t>(ns);
+        int shift = std::bit_width(ns) - 1 - kSubBits;
+        return (static_cast<size_t>(shift) + 1) * kSub + static_cast<size_t>((ns >> shift) - kSub);
+    }
+
+    static constexpr uint64_t upper_bound_of(size_t bucket) {
+        if (bucket < kSub) return bucket;
+        size_t shift = bucket / kSub - 1;
+        return ((bucket % kSub + kSub + 1) << shift) - 1;
+    }
+
+private:
+    struct Shard {
+        std::array<std::atomic<uint64_t>, kBuckets> counts{};
+    };
+
+    Shard& local_shard() {
+        auto& slot = m_shards[thread_shard_index() % kShards];
+        Shard* shard = slot.load(std::memory_order_acquire);
+        if (shard == nullptr) [[unlikely]] {
+            auto* fresh = new Shard;
+            if (slot.compare_exchange_strong(shard, fresh, std::memory_order_acq_rel)) {
+                shard = fresh;
+            } else {
+                delete fresh;   // another thread on this slot won
+            }
+        }
+        return *shard;
+    }
+
+    std::array<std::atomic<Shard*>, kShards> m_shards{};
+};
+
+static_assert(LatencyHistogram::bucket_of(63) == 63 && LatencyHistogram::bucket_of(64) == 64);
+static_assert(LatencyHistogram::upper_bound_of(LatencyHistogram::bucket_of(1'000'000)) >= 1'000'000);
+
+// Records the lifetime of the enclosing scope into a histogram
+class ScopedTimer {
+public:
+    explicit ScopedTimer(LatencyHistogram& histogram)
+        : m_histogram(histogram), m_start(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() { m_histogram.record(std::chrono::steady_clock::now() - m_start); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    LatencyHistogram&                     m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// TRACE_SCOPE(histogram); times the rest of the current block
+#define TRACE_SCOPE(histogram) ScopedTimer CONCAT_EXPANDED(scoped_timer_, __LINE__)(histogram)
+
+void test_other_parts() {
+    // Rvalue references (C++11)
+    int a = 3, b = 4;
+    int&& rv = a + b; // binds to rvalue (7)
+    std::cout << "rvalue reference: " << rv << "\n";
+
+    // Static assertions (C++11)
+    static_assert(sizeof(void*) == sizeof(std::uintptr_t), "Pointer size mismatch");
+
+    // sizeof on class member (C++11)
+    struct A { double data; };
+    std::cout << "Size of A::data: " << sizeof(A::data) << "\n";
+
+    // alignof and alignas (C++11): see Vec4 and Mat4 above
+    static_assert(alignof(Vec4) == 16);
+    static_assert(alignof(Mat4) == 16 && sizeof(Mat4) == sizeof(float) * 16);
+    alignas(float) unsigned char matrix[sizeof(float) * 16];
+
+    // Compile-time layout reports, and a dump of the padding they find
+    static_assert(layout_of<Point>().padding == 0 && layout_of<Point>().matches_sizeof);
+    static_assert(layout_of<Derived, Base, int>().matches_sizeof);
+    struct HotStats {
+        bool             enabled;
+        double           mean;
+        std::atomic<int> hits;
+        char             tag;
+        std::atomic<int> misses;
+    };
+    constexpr auto hot = layout_of<HotStats>();
+    static_assert(hot.matches_sizeof && hot.savings() == 8 && hot.false_sharing_pairs == 1);
+    dump_layout<Person>(std::cout, "Person");
+    dump_layout<Derived, Base, int>(std::cout, "Derived");
+    dump_layout<HotStats>(std::cout, "HotStats");
+
+    Mat4 scale = Mat4::identity();
+    scale.cols[0].x = 2.0f;
+    Vec4 vx{1, 0, 0, 0}, vy{0, 1, 0, 0};
+    Vec4 vz = cross(vx, vy);
+    Vec4 scaled = (scale * scale) * Vec4{1, 2, 3, 1};
+    std::cout << "cross(x, y): (" << vz.x << ", " << vz.y << ", " << vz.z << "), dot: " << dot(vx, vy) << "\n";
+    std::cout << "scale^2 * (1,2,3,1): (" << scaled.x << ", " << scaled.y << ", " << scaled.z << ", " << scaled.w << ")\n";
+
+    // Complex kernels on both layouts, and an FFT round trip
+    ComplexArray<double> interleaved(2);
+    ComplexArray<float, ComplexLayout::Split> split(2);
+    interleaved.set(0, comp1);
+    interleaved.set(1, 1.0 + comp1);
+    split.set(0, comp2);
+    split.set(1, 1.0f + comp2);
+    interleaved *= interleaved;
+    split += split;
+    split.conjugate();
+    std::cout << "(5i)^2: " << interleaved[0] << ", conj(2 * (1+2.5i)): " << split[1] << "\n";
+
+    Fft<float> fft(8);
+    std::vector<std::complex<float>> signal(8);
+    for (size_t i = 0; i < signal.size(); ++i) signal[i] = std::cos(2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / 8.0f);
+    fft.forward(signal);
+    std::cout << "FFT of cos(2*pi*i/8): |X1| = " << std::abs(signal[1]) << ", |X7| = " << std::abs(signal[7]) << ", |X2| = " << std::abs(signal[2]) << "\n";
+    fft.inverse(signal);
+    std::cout << "inverse FFT x[0]: " << signal[0].real() << "\n";
+
+    // Thread-local storage (C++11)
+    thread_local int tls_counter = 0;
+    tls_counter += 1;
+    std::cout << "Thread-local counter: " << tls_counter << "\n";
+
+    // Fork/join over the work-stealing pool
+    std::atomic<long long> sum_squares{0};
+    ShardedCounter chunks;
+    default_pool().parallel_for(0, 100'000, 1'000, [&sum_squares, &chunks](size_t first, size_t last) {
+        long long local = 0;
+        for (size_t i = first; i < last; ++i) local += static_cast<long long>(i * i);
+        sum_squares.fetch_add(local, std::memory_order_relaxed);
+        chunks.add();
+    });
+    std::cout << "parallel_for sum of squares: " << sum_squares << " (" << default_pool().size() << " workers)\n";
+    std::cout << "ShardedCounter chunks: " << chunks.value() << "\n";
+
+    LatencyHistogram latencies;
+    for (int i = 0; i < 100; ++i) {
+        TRACE_SCOPE(latencies);
+        do_not_optimize(std::sqrt(static_cast<double>(i)));
+    }
+    latencies.report(std::cout, "sqrt scope latency");
+
+    int result = must_use();
+    (void)result; // avoid unused warning
+}
+
+// =============================
+// Object-Oriented
+// =============================
+
+// In-class member initializer (C++11)
+struct InClassInit {
+    int value = 100;
+};
+
+// Inline static member initialization (C++17)
+struct InlineStaticInit {
+    static inline int static_val = 200;
+};
+
+// Delegating constructors (C++11)
+struct Delegating {
+    int value;
+    Delegating() : Delegating(-1) {} // delegates to Delegating(int)
+    Delegating(int v) : value(v) {}
+};
+
+// Inherited constructors (C++11)
+struct BaseCtor {
+    int value;
+    BaseCtor() : value(0) {}
+    BaseCtor(int v) : value(v) {}
+};
+
+struct InheritedCtor : public BaseCtor {
+    using BaseCtor::BaseCtor; // inherit constructors
+};
+
+// Move constructor (C++11)
+class ClsMove {
+public:
+    int* ptr;
+    ClsMove() { ptr = new int(0); }
+    ClsMove(const ClsMove& other) { ptr = new int(*other.ptr); }
+    ClsMove(ClsMove&& other) noexcept { ptr = other.ptr; other.ptr = nullptr; }
+    ~ClsMove() { delete ptr; }
+};
+
+// Object pool with thread-local free lists and bulk release.
+// Each thread carves fixed-size slots out of its own blocks, so create/destroy
+// are a pointer pop/push with no locking. A slot freed on another thread goes
+// back to the block's owner through a lock-free remote list, which the owner
+// takes over when its own free list runs dry. Blocks are aligned to their
+// power-of-two size, so a slot finds its owner by masking its address.
+// Objects must be destroyed before the thread that created them exits or
+// calls release().
+template<typename T, size_t SlotsPerBlock = 4096>
+class Pool {
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Cache;
+
+    static constexpr size_t kHeader     = (sizeof(Cache*) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+    static constexpr size_t kBlockBytes = std::bit_ceil(kHeader + SlotsPerBlock * sizeof(Slot));
+    static constexpr size_t kSlots      = (kBlockBytes - kHeader) / sizeof(Slot);   // at least SlotsPerBlock
+
+    struct Block {
+        Cache* owner;
+        Slot   slots[kSlots];
+    };
+
+    struct FreeBlock {
+        void operator()(Block* block) const noexcept { ::operator delete(block, std::align_val_t{kBlockBytes}); }
+    };
+
+    struct Cache {
+        Slot*                                          free = nullptr;
+        std::atomic<Slot*>                             remote{nullptr};   // pushed by other threads
+        std::vector<std::unique_ptr<Block, FreeBlock>> blocks;
+    };
+
+    static Cache& cache() {
+        thread_local Cache local;
+        return local;
+    }
+
+public:
+    template<typename... Args>
+    static T* create(Args&&... args) {
+        Cache& local = cache();
+        if (local.free == nullptr) {
+            local.free = local.remote.exchange(nullptr, std::memory_order_acquire);
+            if (local.free == nullptr) refill(local);
+        }
+        Slot* slot = local.free;
+        local.free = slot->next;
+        return ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+    }
+
+    static void destroy(T* object) noexcept {
+        if (object == nullptr) return;
+        object->~T();
+        Slot*  slot  = reinterpret_cast<Slot*>(object);
+        Cache* owner = reinterpret_cast<Block*>(reinterpret_cast<uintptr_t>(slot) & ~(kBlockBytes - 1))->owner;
+        Cache& local = cache();
+        if (owner == &local) {
+            slot->next = local.free;
+            local.free = slot;
+            return;
+        }
+        slot->next = owner->remote.load(std::memory_order_relaxed);
+        while (!owner->remote.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Bulk release: frees every block of the calling thread at once
+    static void release() noexcept {
+        Cache& local = cache();
+        local.free = nullptr;
+        local.remote.store(nullptr, std::memory_order_relaxed);
+        local.blocks.clear();
+    }
+
+private:
+    static void refill(Cache& local) {
+        std::unique_ptr<Block, FreeBlock> block(::new (::operator new(sizeof(Block), std::align_val_t{kBlockBytes})) Block);
+        block->owner = &local;
+        for (size_t i = 0; i + 1 < kSlots; ++i) {
+            block->slots[i].next = &block->slots[i + 1];
+        }
+        block->slots[kSlots - 1].next = local.free;
+        local.free = &block->slots[0];
+        local.blocks.push_back(std::move(block));
+    }
+};
+
+// ClsMove with its payload drawn from Pool<int> instead of the global heap
+class PooledClsMove {
+public:
+    int* ptr;
+    PooledClsMove() { ptr = Pool<int>::create(0); }
+    PooledClsMove(const PooledClsMove& other) { ptr = Pool<int>::create(*other.ptr); }
+    PooledClsMove(PooledClsMove&& other) noexcept { ptr = other.ptr; other.ptr = nullptr; }
+    ~PooledClsMove() { Pool<int>::destroy(ptr); }
+};
+
+// Bounded lock-free queues that move elements in and out, never copy them.
+// Capacity is a power of two; the producer and consumer indices sit on their
+// own cache lines so the two sides do not false-share.
+
+// Single producer, single consumer. Each side also caches the other side's
+// index and only reloads it when the queue looks full (or empty).
+template<typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+public:
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue() {
+        for (size_t i = m_tail.load(std::memory_order_relaxed); i != m_head.load(std::memory_order_relaxed); ++i) {
+            item(i)->~T();
+        }
+    }
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail_cache == Capacity) {
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            if (head - m_tail_cache == Capacity) return false;
+        }
+        ::new (static_cast<void*>(m_slots[head & (Capacity - 1)].bytes)) T(std::forward<Args>(args)...);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    std::optional<T> try_pop() {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head_cache) {
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            if (tail == m_head_cache) return std::nullopt;
+        }
+        std::optional<T> out(std::move(*item(tail)));
+        item(tail)->~T();
+        m_tail.store(tail + 1, std::memory_order_release);
+        return out;
+    }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    T* item(size_t index) { return std::launder(reinterpret_cast<T*>(m_slots[index & (Capacity - 1)].bytes)); }
+
+    alignas(64) std::atomic<size_t> m_head{0};   // written by the producer
+    size_t m_tail_cache = 0;                     // producer's last view of m_tail
+    alignas(64) std::atomic<size_t> m_tail{0};   // written by the consumer
+    size_t m_head_cache = 0;                     // consumer's last view of m_head
+    alignas(64) std::array<Slot, Capacity> m_slots;
+};
+
+// Any number of producers and consumers (Vyukov's bounded queue). Every cell
+// carries a sequence number that says whose turn it is, so a push or pop is
+// one CAS on the shared index and no cell is ever touched by two threads at once.
+template<typename T, size_t Capacity>
+class MpmcQueue {
+    static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+public:
+    MpmcQueue() {
+        for (size_t i = 0; i < Capacity; ++i) m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    ~MpmcQueue() {
+        while (try_pop()) {}
+    }
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t pos = m_enqueue.load(std::memory_order_relaxed);
+        while (true) {
+            Cell&     cell = m_cells[pos & (Capacity - 1)];
+            size_t    seq  = cell.sequence.load(std::memory_order_acquire);
+            ptrdiff_t diff = static_cast<ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ::new (static_cast<void*>(cell.bytes)) T(std::forward<Args>(args)...);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = m_enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    std::optional<T> try_pop() {
+        size_t pos = m_dequeue.load(std::memory_order_relaxed);
+        while (true) {
+            Cell&     cell = m_cells[pos & (Capacity - 1)];
+            size_t    seq  = cell.sequence.load(std::memory_order_acquire);
+            ptrdiff_t diff = static_cast<ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (m_dequeue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    T* value = std::launder(reinterpret_cast<T*>(cell.bytes));
+                    std::optional<T> out(std::move(*value));
+                    value->~T();
+                    cell.sequence.store(pos + Capacity, std::memory_order_release);
+                    return out;
+                }
+            } else if (diff < 0) {
+                return std::nullopt; // empty
+            } else {
+                pos = m_dequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    alignas(64) std::atomic<size_t> m_enqueue{0};
+    alignas(64) std::atomic<size_t> m_dequeue{0};
+    alignas(64) std::array<Cell, Capacity> m_cells;
+};
+
+// Explicit conversion operators (C++11)
+struct BoolWrapper {
+    bool value;
+    explicit BoolWrapper(bool v) : value(v) {}
+    explicit operator bool() const { return value; }
+    explicit operator std::string() const { return value ? "true" : "false"; }
+};
+
+// Explicit virtual function override (C++11)
+struct BaseVirtual {
+    virtual void foo() { std::cout << "BaseVirtual::foo\n"; }
+    virtual void bar() { std::cout << "BaseVirtual::bar\n"; }
+};
+
+struct DerivedVirtual : public BaseVirtual {
+    void foo(int) { std::cout << "DerivedVirtual::foo(int)\n"; }
+    void foo() const { std::cout << "DerivedVirtual::foo() const\n"; } // does not override
+    void bar() override { std::cout << "DerivedVirtual::bar\n"; }     // overrides
+};
+
+// final (C++11)
+struct FinalClass final {
+    void display() { std::cout << "This is a final class\n"; }
+};
+
+struct BaseFinal {
+    virtual void foo() {}
+};
+
+struct DerivedFinal : public BaseFinal {
+    void foo() final { std::cout << "DerivedFinal::foo (final)\n"; }
+};
+
+// Devirtualized dispatch for hot loops (final + std::variant)
+// Sealed<T> is a final leaf of T: calls through it resolve to T's overriders
+// at compile time, so a closed set of types can skip the vtable entirely.
+template<typename T>
+struct Sealed final : T {
+    using T::T;
+};
+
+// A implementations that read per-object state, for heterogeneous batches
+// whose calls can't be folded to a constant
+struct C : public A {
+    int value;
+    constexpr explicit C(int v = 7) : value(v) {}
+    constexpr int foo() const override { return value; }
+};
+
+struct D : public A {
+    int value;
+    constexpr explicit D(int v = 0) : value(v) {}
+    constexpr int foo() const override { return value * 3; }
+};
+
+// Closed hierarchy held by value: order is kept, dispatch is a switch on the index
+template<typename... Ts>
+using ClosedVariant = std::variant<Sealed<Ts>...>;
+
+// Heterogeneous batch bucketed by type: one tight loop of direct calls per type
+template<typename... Ts>
+class TypeBuckets {
+public:
+    template<typename T, typename... Args>
+    void emplace(Args&&... args) {
+        std::get<std::vector<Sealed<T>>>(m_buckets).emplace_back(std::forward<Args>(args)...);
+    }
+
+    template<typename F>
+    void for_each(F&& f) {
+        std::apply([&f](auto&... bucket) {
+            ([&] { for (auto& item : bucket) f(item); }(), ...);
+        }, m_buckets);
+    }
+
+    size_t size() const {
+        return std::apply([](const auto&... bucket) { return (bucket.size() + ...); }, m_buckets);
+    }
+
+private:
+    std::tuple<std::vector<Sealed<Ts>>...> m_buckets;
+};
+
+// Operator <=> (three-way comparator) (C++20)
+struct Point3 {
+    float x, y;
+    constexpr auto operator<=>(const Point3& other) const = default;
+};
+
+// Sorting by three-way comparison
+// For aggregates whose members are all arithmetic, the defaulted <=> is a
+// lexicographic compare of the members. sort_records turns each member into an
+// unsigned key with the same order and runs a stable LSD radix sort on them,
+// one byte per pass; other types fall back to std::sort. Whether <=> is the
+// defaulted one can't be detected, so a type opts in with enable_radix_sort.
+template<typename T>
+inline constexpr bool enable_radix_sort = false;
+
+template<>
+inline constexpr bool enable_radix_sort<Point3> = true;
+
+// The member count is checked before members_of is named, so aggregates past
+// its 6-member limit fall back to std::sort instead of failing to compile
+template<typename T>
+concept MemberwiseOrdered = enable_radix_sort<T> && std::is_aggregate_v<T> && std::three_way_comparable<T> &&
+    (field_count<T>() >= 1 && field_count<T>() <= 6) &&
+    []<typename... Ms>(std::tuple<Ms&...>*) {
+        return ((std::is_arithmetic_v<Ms> && (sizeof(Ms) <= 8) && (!std::is_floating_point_v<Ms> || sizeof(Ms) == 4 || sizeof(Ms) == 8)) && ...);
+    }(static_cast<decltype(members_of(std::declval<T&>()))*>(nullptr));
+
+// Unsigned key with the same ordering as the value (floats: -0.0 gets the key
+// of +0.0, since <=> treats them as equal)
+template<typename M>
+constexpr auto order_key(M value) {
+    if constexpr (std::is_same_v<M, bool>) {
+        return static_cast<uint8_t>(value);
+    } else if constexpr (std::is_floating_point_v<M>) {
+        using U = std::conditional_t<sizeof(M) == 4, uint32_t, uint64_t>;
+        constexpr U kSign = U{1} << (sizeof(U) * 8 - 1);
+        U bits = std::bit_cast<U>(value == M{0} ? M{0} : value);
+        return (bits & kSign) ? static_cast<U>(~bits) : static_cast<U>(bits | kSign);
+    } else if constexpr (std::is_signed_v<M>) {
+        using U = std::make_unsigned_t<M>;
+        return static_cast<U>(static_cast<U>(value) ^ (U{1} << (sizeof(U) * 8 - 1)));
+    } else {
+        return value;
+    }
+}
+
+template<MemberwiseOrdered T>
+void radix_sort(std::span<T> data) {
+    if (data.empty()) return;
+    std::vector<T> buffer(data.size());
+    T* src = data.data();
+    T* dst = buffer.data();
+
+    // One counting-sort pass on byte `shift / 8` of member I
+    auto pass = [&]<size_t I>(std::integral_constant<size_t, I>, unsigned shift) {
+        auto digit = [shift](const T& value) {
+            return static_cast<size_t>((order_key(std::get<I>(members_of(value))) >> shift) & 0xFF);
+        };
+        std::array<size_t, 256> offsets{};
+        for (size_t i = 0; i < data.size(); ++i) ++offsets[digit(src[i])];
+        if (offsets[digit(src[0])] == data.size()) return; // every key shares this byte
+        size_t sum = 0;
+        for (auto& offset : offsets) sum += std::exchange(offset, sum);
+        for (size_t i = 0; i < data.size(); ++i) dst[offsets[digit(src[i])]++] = src[i];
+        std::swap(src, dst);
+    };
+
+    // Least significant digit first: last member to first, low byte to high byte
+    constexpr size_t kMembers = std::tuple_size_v<decltype(members_of(std::declval<T&>()))>;
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        auto member_passes = [&]<size_t M>(std::integral_constant<size_t, M> member) {
+            using Key = decltype(order_key(std::get<M>(members_of(std::declval<T&>()))));
+            for (unsigned shift = 0; shift < sizeof(Key) * 8; shift += 8) pass(member, shift);
+        };
+        (member_passes(std::integral_constant<size_t, kMembers - 1 - I>{}), ...);
+    }(std::make_index_sequence<kMembers>{});
+
+    if (src != data.data()) {
+        std::copy(src, src + data.size(), data.data());
+    }
+}
+
+template<std::ranges::contiguous_range R>
+void sort_records(R&& range) {
+    using T = std::ranges::range_value_t<R>;
+    std::span<T> data(std::ranges::data(range), std::ranges::size(range));
+    if constexpr (MemberwiseOrdered<T>) {
+        if (data.size() >= 256) {
+            radix_sort(data);
+            return;
+        }
+    }
+    std::sort(data.begin(), data.end(), [](const T& a, const T& b) { return a < b; });
+}
+
+// Branchless lower_bound: the loop has a fixed trip count and a conditional
+// move instead of a hard-to-predict branch
+template<typename T>
+size_t lower_bound_index(std::span<const T> sorted, const T& value) {
+    const T* base = sorted.data();
+    size_t   n    = sorted.size();
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (base[half - 1] < value) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<size_t>(base - sorted.data()) + (n == 1 && *base < value);
+}
+
+// Defaulted special member functions (C++11)
+struct DefaultMembers {
+    DefaultMembers() = default;
+    DefaultMembers(const DefaultMembers&) = default;
+    DefaultMembers(DefaultMembers&&) = default;
+    ~DefaultMembers() = default;
+    DefaultMembers& operator=(const DefaultMembers&) = default;
+    DefaultMembers& operator=(DefaultMembers&&) = default;
+};
+
+// Deleted special member functions (C++11)
+struct DeletedMembers {
+    DeletedMembers() = delete;
+    DeletedMembers(const DeletedMembers&) = delete;
+    DeletedMembers(DeletedMembers&&) = delete;
+    ~DeletedMembers() = delete;
+    DeletedMembers& operator=(const DeletedMembers&) = delete;
+};
+
+// Ref-qualifiers (C++11)
+struct RefQualifier {
+    void foo() &  { std::cout << "Lvalue foo\n"; }
+    void foo() && { std::cout << "Rvalue foo\n"; }
+    void foo() const & { std::cout << "Const lvalue foo\n"; }
+    void foo() const &&{ std::cout << "Const rvalue foo\n"; }
+};
+
+// Explicit object member functions (C++23)
+struct ExplicitMember {
+    InternedString name;
+    void getName(this ExplicitMember& self) { std::cout << "Lvalue name: " << self.name << "\n"; }
+    void getName(this ExplicitMember&& self) { std::cout << "Rvalue name: " << std::move(self.name) << "\n"; }
+};
+
+// Strongly typed enumeration (C++11)
+enum class StatusCode : uint8_t { OK = 0, Error = 1 };
+
+// Compile-time perfect hashing (consteval)
+// A fixed key set is hashed once at compile time ("hash and displace"): keys
+// are grouped into buckets by a first hash, and every bucket gets its own
+// seed (or, for a single key, a direct slot) so that no two keys share a slot.
+// A lookup is one key hash, at most two multiplies, and a single compare.
+// Little-endian load of count <= 8 bytes; a plain unaligned load at run time
+constexpr uint64_t load_le(const char* p, size_t count) {
+    if !consteval {
+        if (std::endian::native == std::endian::little && count == 8) {
+            uint64_t w;
+            std::memcpy(&w, p, 8);
+            return w;
+        }
+        if (std::endian::native == std::endian::little && count == 4) {
+            uint32_t w;
+            std::memcpy(&w, p, 4);
+            return w;
+        }
+    }
+    uint64_t w = 0;
+    for (size_t b = 0; b < count; ++b) w |= static_cast<uint64_t>(static_cast<unsigned char>(p[b])) << (8 * b);
+    return w;
+}
+
+// String keys are read eight bytes per multiply; shorter keys as two
+// overlapping halves
+constexpr uint64_t key_hash(std::string_view key) {
+    const char* p = key.data();
+    size_t      n = key.size();
+    uint64_t    h = 0x9E3779B97F4A7C15ull ^ n;
+    uint64_t    w;
+    if (n >= 8) {
+        for (size_t i = 0; i + 8 < n; i += 8) {
+            h = (h ^ load_le(p + i, 8)) * 0xFF51AFD7ED558CCDull;
+            h ^= h >> 32;
+        }
+        w = load_le(p + n - 8, 8); // last eight bytes, possibly overlapping
+    } else if (n >= 4) {
+        w = load_le(p, 4) | (load_le(p + n - 4, 4) << 32);
+    } else {
+        w = load_le(p, n);
+    }
+    h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+    return h ^ (h >> 32);
+}
+
+template<typename E> requires std::is_enum_v<E>
+constexpr uint64_t key_hash(E key) {
+    return static_cast<uint64_t>(std::to_underlying(key));
+}
+
+template<typename K, typename V, size_t N>
+class PerfectHashMap {
+    static constexpr size_t  kSlots   = std::bit_ceil(N);
+    static constexpr size_t  kMask    = kSlots - 1;
+    static constexpr int32_t kMaxSeed = 1 << 16;
+
+public:
+    consteval explicit PerfectHashMap(const std::array<std::pair<K, V>, N>& entries) : m_entries(entries) {
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = i + 1; j < N; ++j) {
+                if (entries[i].first == entries[j].first) throw "duplicate key in perfect hash";
+            }
+        }
+
+        std::array<uint64_t, N> hashes{};
+        std::array<std::vector<uint32_t>, kSlots> buckets;
+        for (uint32_t i = 0; i < N; ++i) {
+            hashes[i] = key_hash(entries[i].first);
+            buckets[mix(hashes[i], 0) & kMask].push_back(i);
+        }
+
+        // Largest buckets first, while the table still has room
+        std::array<size_t, kSlots> order{};
+        for (size_t b = 0; b < kSlots; ++b) order[b] = b;
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        m_slots.fill(N);
+        for (size_t b : order) {
+            const auto& bucket = buckets[b];
+            if (bucket.size() == 1) {
+                size_t slot = 0;
+                while (m_slots[slot] != N) ++slot;
+                m_slots[slot]  = bucket[0];
+                m_displace[b] = -static_cast<int32_t>(slot) - 1;
+            } else if (bucket.size() > 1) {
+                for (int32_t seed = 1;; ++seed) {
+                    if (seed == kMaxSeed) throw "no perfect hash found";
+                    std::vector<size_t> taken;
+                    for (uint32_t key : bucket) {
+                        size_t slot = mix(hashes[key], seed) & kMask;
+                        if (m_slots[slot] != N || std::find(taken.begin(), taken.end(), slot) != taken.end()) break;
+                        taken.push_back(slot);
+                    }
+                    if (taken.size() == bucket.size()) {
+                        for (size_t i = 0; i < taken.size(); ++i) m_slots[taken[i]] = bucket[i];
+                        m_displace[b] = seed;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    constexpr const V* find(const K& key) const {
+        uint64_t h    = key_hash(key);
+        int32_t  d    = m_displace[mix(h, 0) & kMask];
+        size_t   slot = d < 0 ? static_cast<size_t>(-d - 1) : mix(h, d) & kMask;
+        uint32_t e    = m_slots[slot];
+        return (e < N && m_entries[e].first == key) ? &m_entries[e].second : nullptr;
+    }
+
+    static constexpr size_t size() { return N; }
+
+private:
+    // Multiplicative hash of the key hash and seed; the slot is taken from the high bits
+    static constexpr size_t mix(uint64_t h, int32_t seed) {
+        constexpr int kBits = std::countr_zero(kSlots);
+        if constexpr (kBits == 0) return 0;
+        else return static_cast<size_t>(((h ^ static_cast<uint64_t>(seed) * 0xC2B2AE3D27D4EB4Full) * 0x9E3779B97F4A7C15ull) >> (64 - kBits));
+    }
+
+    std::array<std::pair<K, V>, N> m_entries{};
+    std::array<int32_t, kSlots>    m_displace{};  // bucket -> seed, or -(slot + 1) for a single key
+    std::array<uint32_t, kSlots>   m_slots{};     // slot -> entry index, N when empty
+};
+
+// O(1) enum <-> string conversion over a fixed name table
+template<typename E, size_t N>
+class EnumNames {
+public:
+    consteval explicit EnumNames(const std::array<std::pair<E, std::string_view>, N>& names)
+        : m_to_name(names), m_from_name(swapped(names)) {}
+
+    constexpr std::string_view to_string(E value) const {
+        const std::string_view* name = m_to_name.find(value);
+        return name ? *name : std::string_view{};
+    }
+
+    constexpr std::optional<E> from_string(std::string_view name) const {
+        const E* value = m_from_name.find(name);
+        return value ? std::optional<E>(*value) : std::nullopt;
+    }
+
+private:
+    static consteval std::array<std::pair<std::string_view, E>, N> swapped(const std::array<std::pair<E, std::string_view>, N>& names) {
+        std::array<std::pair<std::string_view, E>, N> out{};
+        for (size_t i = 0; i < N; ++i) out[i] = {names[i].second, names[i].first};
+        return out;
+    }
+
+    PerfectHashMap<E, std::string_view, N> m_to_name;
+    PerfectHashMap<std::string_view, E, N> m_from_name;
+};
+
+constexpr EnumNames status_code_names{std::to_array<std::pair<StatusCode, std::string_view>>({
+    {StatusCode::OK, "OK"}, {StatusCode::Error, "Error"},
+})};
+
+// Protocol status lines, e.g. the reason phrase of an HTTP response
+enum class HttpStatus : uint16_t {
+    Ok = 200, Created = 201, NoContent = 204, MovedPermanently = 301, NotModified = 304, BadRequest = 400,
+    Unauthorized = 401, Forbidden = 403, NotFound = 404, InternalServerError = 500, ServiceUnavailable = 503,
+};
+
+constexpr EnumNames http_status_names{std::to_array<std::pair<HttpStatus, std::string_view>>({
+    {HttpStatus::Ok, "OK"}, {HttpStatus::Created, "Created"}, {HttpStatus::NoContent, "No Content"},
+    {HttpStatus::MovedPermanently, "Moved Permanently"}, {HttpStatus::NotModified, "Not Modified"},
+    {HttpStatus::BadRequest, "Bad Request"}, {HttpStatus::Unauthorized, "Unauthorized"},
+    {HttpStatus::Forbidden, "Forbidden"}, {HttpStatus::NotFound, "Not Found"},
+    {HttpStatus::InternalServerError, "Internal Server Error"}, {HttpStatus::ServiceUnavailable, "Service Unavailable"},
+})};
+
+static_assert(http_status_names.from_string("Not Found") == HttpStatus::NotFound);
+static_assert(http_status_names.to_string(HttpStatus::Forbidden) == "Forbidden" && !http_status_names.from_string("Teapot"));
+
+// Multidimensional subscript operator (C++23)
+// MultiArray lives in multi_array.h
+
+void test_object_oriented() {
+    InClassInit ic;
+    std::cout << "InClassInit value: " << ic.value << "\n";
+
+    std::cout << "InlineStaticInit static_val: " << InlineStaticInit::static_val << "\n";
+
+    Delegating d1;
+    Delegating d2(123);
+    std::cout << "Delegating d1.value: " << d1.value << ", d2.value: " << d2.value << "\n";
+
+    InheritedCtor ih1;
+    InheritedCtor ih2(456);
+    std::cout << "InheritedCtor ih1.value: " << ih1.value << ", ih2.value: " << ih2.value << "\n";
+
+    ClsMove cm1;
+    ClsMove cm2 = std::move(cm1);
+    std::cout << "ClsMove cm2.ptr: " << (cm2.ptr ? *cm2.ptr : -1) << "\n";
+
+    PooledClsMove pm1;
+    PooledClsMove pm2 = pm1;            // copy draws a new slot from the pool
+    PooledClsMove pm3 = std::move(pm1); // move just steals the slot
+    std::cout << "PooledClsMove pm2.ptr: " << *pm2.ptr << ", pm1 moved-from: " << std::boolalpha << (pm1.ptr == nullptr) << "\n";
+
+    SpscQueue<ClsMove, 4> spsc;
+    MpmcQueue<ClsMove, 4> mpmc;
+    ClsMove queued;
+    int* payload = queued.ptr;
+    spsc.try_push(std::move(queued));
+    mpmc.try_push(std::move(*spsc.try_pop()));
+    std::optional<ClsMove> dequeued = mpmc.try_pop();
+    std::cout << "ClsMove through SpscQueue and MpmcQueue kept its payload: " << (dequeued->ptr == payload)
+              << ", now empty: " << !mpmc.try_pop().has_value() << "\n";
+
+    BoolWrapper bw(true);
+    bool bw_bool = static_cast<bool>(bw);
+    std::cout << "BoolWrapper as bool: " << std::boolalpha << bw_bool << "\n";
+
+    DerivedVirtual dv;
+    BaseVirtual* bv = &dv;
+    bv->foo(); // calls BaseVirtual::foo
+    bv->bar(); // calls DerivedVirtual::bar
+
+    FinalClass fc;
+    fc.display();
+
+    DerivedFinal df;
+    df.foo();
+
+    std::vector<ClosedVariant<BaseVirtual, DerivedVirtual>> closed(2);
+    closed[1] = Sealed<DerivedVirtual>{};
+    for (auto& item : closed) {
+        std::visit([](auto& obj) { obj.bar(); }, item); // direct calls, no vtable
+    }
+
+    Point3 p1{1.0f, 2.0f}, p2{1.0f, 2.0f};
+    if (p1 == p2) {
+        std::cout << "Points are equal\n";
+    }
+
+    SoA<Point3> points3;
+    points3.push_back(p1);
+    points3.push_back({ .x = 3.0f, .y = 4.0f });
+    std::cout << "SoA<Point3> y column: " << points3.column<1>()[0] << ", " << points3.column<1>()[1] << "\n";
+
+    static_assert(MemberwiseOrdered<Point3> && !MemberwiseOrdered<Person>);
+    std::vector<Point3> cloud;
+    for (int i = 0; i < 1'000; ++i) cloud.push_back({static_cast<float>(i % 7) - 3.0f, static_cast<float>(-i)});
+    sort_records(cloud); // radix path
+    size_t pos = lower_bound_index(std::span<const Point3>(cloud), Point3{0.0f, -500.0f});
+    std::cout << "sorted Point3 front: (" << cloud.front().x << ", " << cloud.front().y << "), sorted: "
+              << std::is_sorted(cloud.begin(), cloud.end()) << ", lower_bound {0, -500}: " << pos << "\n";
+
+    DefaultMembers dm;
+
+    // DeletedMembers dm2; // Error: constructor deleted
+
+    RefQualifier rq;
+    rq.foo();          // lvalue
+    RefQualifier().foo(); // rvalue
+
+    ExplicitMember em{InternedString("Charlie")};
+    em.getName();      // lvalue overload
+    ExplicitMember{InternedString("Dave")}.getName(); // rvalue overload
+
+    StatusCode sc = StatusCode::OK;
+    // int code = sc; // Error: no implicit conversion
+    int code = static_cast<int>(sc);
+    std::cout << "StatusCode as int: " << code << "\n";
+    std::cout << "StatusCode name: " << status_code_names.to_string(sc) << ", \"Not Modified\" -> "
+              << std::to_underlying(*http_status_names.from_string("Not Modified")) << "\n";
+
+    MultiArray<int> ma{2, 2, 2};
+    ma[0, 0, 0] = 7;
+    std::cout << "MultiArray[0,0,0]: " << ma[0, 0, 0] << "\n";
+
+    MultiArray<float, 3, Layout::Tiled> grid{16, 16, 16};
+    grid[15, 3, 9] = 2.5f;
+    grid *= 2.0f;
+    std::cout << "Tiled grid sum: " << grid.sum() << ", max: " << grid.max() << "\n";
+
+    MultiArray<int, 2> mat{2, 3};
+    mat[0, 2] = 5;
+    auto matT = mat.transposed();
+    std::cout << "Transposed [2,0]: " << matT[2, 0] << " (" << matT.extent(0) << "x" << matT.extent(1) << ")\n";
+}
+
+// =============================
+// Templates
+// =============================
+
+// Extern template (C++11)
+// In header: extern template class std::vector<int>;
+// In one translation unit (instantiations.cpp when built with EXTERN_TEMPLATES=1):
+#if !EXTERN_TEMPLATES
+template class std::vector<int>;     // also covers VecAlias<int>, an alias is not a new type
+template class MultiArray<int>;
+template class MultiArray<float, 3, Layout::Tiled>;
+#endif
+
+// Right-angle brackets (C++11)
+std::vector<std::vector<std::vector<int>>> nestedVec;
+
+// Flattened replacement for three-level nested vectors.
+// All values live in one array and two offset tables locate each inner
+// sequence, so v[i][j][k] is two offset loads instead of three pointer hops.
+// The same layout is the file format: load() maps the file and indexes it in
+// place, with no deserialization.
+template<typename T>
+class JaggedArray {
+    static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= alignof(uint64_t));
+
+public:
+    class Row {
+    public:
+        size_t size() const { return m_size; }
+        std::span<const T> operator[](size_t j) const {
+            return {m_values + m_inner[j], static_cast<size_t>(m_inner[j + 1] - m_inner[j])};
+        }
+
+    private:
+        friend class JaggedArray;
+        Row(const uint64_t* inner, size_t size, const T* values) : m_inner(inner), m_size(size), m_values(values) {}
+
+        const uint64_t* m_inner;    // size + 1 offsets into m_values
+        size_t          m_size;
+        const T*        m_values;
+    };
+
+    JaggedArray() = default;
+
+    explicit JaggedArray(const std::vector<std::vector<std::vector<T>>>& nested) {
+        m_outer_store.push_back(0);
+        m_inner_store.push_back(0);
+        for (const auto& row : nested) {
+            for (const auto& inner : row) {
+                m_value_store.insert(m_value_store.end(), inner.begin(), inner.end());
+                m_inner_store.push_back(m_value_store.size());
+            }
+            m_outer_store.push_back(m_inner_store.size() - 1);
+        }
+        m_outer  = m_outer_store;
+        m_inner  = m_inner_store;
+        m_values = m_value_store;
+    }
+
+    JaggedArray(JaggedArray&&) = default;
+    JaggedArray& operator=(JaggedArray&&) = default;
+
+    size_t size() const { return m_outer.empty() ? 0 : m_outer.size() - 1; }
+    Row operator[](size_t i) const {
+        return Row(m_inner.data() + m_outer[i], m_outer[i + 1] - m_outer[i], m_values.data());
+    }
+
+    // Every value, row after row, for whole-array scans
+    std::span<const T> values() const { return m_values; }
+
+    // File layout: header, outer offsets, inner offsets, values
+    bool save(const char* path) const {
+        std::ofstream file(path, std::ios::binary);
+        Header header{kMagic, size() + 1, m_inner.size(), m_values.size()};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(m_outer.data()), static_cast<std::streamsize>(m_outer.size_bytes()));
+        file.write(reinterpret_cast<const char*>(m_inner.data()), static_cast<std::streamsize>(m_inner.size_bytes()));
+        file.write(reinterpret_cast<const char*>(m_values.data()), static_cast<std::streamsize>(m_values.size_bytes()));
+        return static_cast<bool>(file);
+    }
+
+    static std::optional<JaggedArray> load(const char* path) {
+        auto mapping = std::make_unique<MappedFile>(path);
+        std::string_view bytes = mapping->view();
+        if (!mapping->is_open() || bytes.size() < sizeof(Header)) {
+            return std::nullopt;
+        }
+        Header header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (header.magic != kMagic || header.outer_count == 0 || header.inner_count == 0) {
+            return std::nullopt;
+        }
+        // Counts come from the file: compare them against the remaining bytes
+        // one section at a time, so a crafted count can't overflow the total
+        size_t remaining = bytes.size() - sizeof(Header);
+        if (header.outer_count > remaining / sizeof(uint64_t)) return std::nullopt;
+        remaining -= header.outer_count * sizeof(uint64_t);
+        if (header.inner_count > remaining / sizeof(uint64_t)) return std::nullopt;
+        remaining -= header.inner_count * sizeof(uint64_t);
+        if (remaining % sizeof(T) != 0 || header.value_count != remaining / sizeof(T)) return std::nullopt;
+
+        JaggedArray result;
+        const char* cursor = bytes.data() + sizeof(Header);
+        result.m_outer  = {reinterpret_cast<const uint64_t*>(cursor), header.outer_count};
+        cursor += header.outer_count * sizeof(uint64_t);
+        result.m_inner  = {reinterpret_cast<const uint64_t*>(cursor), header.inner_count};
+        cursor += header.inner_count * sizeof(uint64_t);
+        result.m_values = {reinterpret_cast<const T*>(cursor), header.value_count};
+
+        // Checked once here so operator[] can index without bounds checks
+        if (!valid_offsets(result.m_outer, header.inner_count - 1) || !valid_offsets(result.m_inner, header.value_count)) {
+            return std::nullopt;
+        }
+        result.m_mapping = std::move(mapping);
+        return result;
+    }
+
+private:
+    struct Header {
+        uint64_t magic;
+        uint64_t outer_count;
+        uint64_t inner_count;
+        uint64_t value_count;
+    };
+    static constexpr uint64_t kMagic = 0x4A41474745443031; // "JAGGED01"
+
+    // Offsets start at 0, never decrease and end exactly at last
+    static bool valid_offsets(std::span<const uint64_t> offsets, uint64_t last) {
+        if (offsets.front() != 0 || offsets.back() != last) return false;
+        return std::ranges::is_sorted(offsets);
+    }
+
+    // Views into either the owned vectors or the mapped file
+    std::span<const uint64_t> m_outer;
+    std::span<const uint64_t> m_inner;
+    std::span<const T>        m_values;
+
+    std::vector<uint64_t>       m_outer_store;
+    std::vector<uint64_t>       m_inner_store;
+    std::vector<T>              m_value_store;
+    std::unique_ptr<MappedFile> m_mapping;
+};
+
+// Template argument deduction for class templates (C++17)
+std::vector vec_ctad = {1, 2, 3, 4}; // deduced as std::vector<int>
+
+// Template aliases (C++11)
+template <typename T>
+using VecAlias = std::vector<T>;
+
+// Variadic templates (C++11)
+template<typename T>
+T sum_variadic(T value) {
+    return value;
+}
+
+template<typename T, typename... Ts>
+T sum_variadic(T head, Ts... tail) {
+    return head + sum_variadic(tail...);
+}
+
+// Fold expressions (C++17)
+template<typename... Ts>
+auto sum_fold(Ts... args) {
+    return (args + ...);
+}
+
+// Range folds
+// Generalize sum_fold/sum_variadic from parameter packs to contiguous ranges.
+// Op must be associative and commutative: elements are spread over independent
+// accumulators (so the loop vectorizes) and, for large inputs, over threads.
+// FoldOrder::Deterministic uses a fixed chunking so floating-point results do
+// not depend on the number of cores.
+enum class FoldOrder { Fast, Deterministic };
+
+template<typename T, typename E, typename Op>
+T fold_lanes(const E* first, size_t n, Op op) {
+    constexpr size_t kLanes = 8;
+    if (n < kLanes) {
+        T acc = static_cast<T>(first[0]);
+        for (size_t i = 1; i < n; ++i) acc = op(acc, static_cast<T>(first[i]));
+        return acc;
+    }
+    T acc[kLanes];
+    for (size_t l = 0; l < kLanes; ++l) acc[l] = static_cast<T>(first[l]);
+    size_t i = kLanes;
+    for (; i + kLanes <= n; i += kLanes) {
+        for (size_t l = 0; l < kLanes; ++l) {
+            acc[l] = op(acc[l], static_cast<T>(first[i + l]));
+        }
+    }
+    for (; i < n; ++i) acc[0] = op(acc[0], static_cast<T>(first[i]));
+    for (size_t l = 1; l < kLanes; ++l) acc[0] = op(acc[0], acc[l]);
+    return acc[0];
+}
+
+template<std::ranges::contiguous_range R, typename T, typename Op>
+T fold_range(const R& range, T init, Op op, FoldOrder order = FoldOrder::Fast) {
+    constexpr size_t kParallelThreshold  = size_t{1} << 20;
+    constexpr size_t kDeterministicChunk = size_t{1} << 16;
+
+    const auto*  data = std::ranges::data(range);
+    const size_t n    = std::ranges::size(range);
+    if (n == 0) return init;
+
+    size_t threads = n < kParallelThreshold ? 1 : std::max(1u, std::thread::hardware_concurrency());
+    size_t chunk   = order == FoldOrder::Deterministic ? kDeterministicChunk : (n + threads - 1) / threads;
+    size_t chunks  = (n + chunk - 1) / chunk;
+    threads = std::min(threads, chunks);
+
+    // Each thread folds a contiguous run of chunks; partials are combined in order
+    std::vector<T> partials(chunks);
+    auto work = [&](size_t t) {
+        size_t per_thread = (chunks + threads - 1) / threads;
+        for (size_t c = t * per_thread; c < std::min(chunks, (t + 1) * per_thread); ++c) {
+            size_t begin = c * chunk;
+            partials[c] = fold_lanes<T>(data + begin, std::min(chunk, n - begin), op);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) {
+        pool.emplace_back(work, t);
+    }
+    work(0);
+    for (auto& th : pool) {
+        th.join();
+    }
+
+    for (const T& partial : partials) {
+        init = op(init, partial);
+    }
+    return init;
+}
+
+template<std::ranges::contiguous_range R>
+auto sum_range(const R& range, FoldOrder order = FoldOrder::Fast) {
+    return fold_range(range, std::ranges::range_value_t<R>{}, std::plus<>{}, order);
+}
+
+template<std::ranges::contiguous_range R>
+auto min_range(const R& range) {
+    assert(!std::ranges::empty(range));
+    using T = std::ranges::range_value_t<R>;
+    return fold_range(range, *std::ranges::begin(range), [](T a, T b) { return b < a ? b : a; });
+}
+
+template<std::ranges::contiguous_range R>
+auto max_range(const R& range) {
+    assert(!std::ranges::empty(range));
+    using T = std::ranges::range_value_t<R>;
+    return fold_range(range, *std::ranges::begin(range), [](T a, T b) { return a < b ? b : a; });
+}
+
+void test_templates() {
+    std::cout << "sum_variadic(1,2.5,3): " << sum_variadic(1, 2.5, 3) << "\n";
+    std::cout << "sum_fold(1, 2, 3, 4): " << sum_fold(1, 2, 3, 4) << "\n";
+
+    VecAlias<int> myVec = {10, 20, 30};
+    for (auto v : myVec) {
+        std::cout << "VecAlias element: " << v << "\n";
+    }
+
+    std::cout << "sum_range(myVec): " << sum_range(myVec) << "\n";
+    std::cout << "min_range/max_range(myVec): " << min_range(myVec) << "/" << max_range(myVec) << "\n";
+    double doubles[] = {0.1, 0.2, 0.3};
+    std::cout << "sum_range(doubles, Deterministic): " << sum_range(doubles, FoldOrder::Deterministic) << "\n";
+
+    nestedVec = {{{1, 2}, {3}}, {{4, 5, 6}}};
+    JaggedArray<int> jagged(nestedVec);
+    std::cout << "JaggedArray[1][0][2]: " << jagged[1][0][2] << ", rows: " << jagged.size() << "\n";
+}
+
+// Saves and maps a JaggedArray file; run once from main, outside the benchmarked sections
+void test_jagged_file() {
+    JaggedArray<int> jagged(nestedVec);
+    auto path = unique_temp_path("jagged_example");
+    if (jagged.save(path.c_str())) {
+        if (auto mapped = JaggedArray<int>::load(path.c_str())) {
+            std::cout << "mapped JaggedArray[0][1][0]: " << (*mapped)[0][1][0] << ", [0] size: " << (*mapped)[0].size() << "\n";
+        }
+        std::remove(path.c_str());
+    }
+}
+
+// =============================
+// Coroutines
+// =============================
+
+// Coroutine frame allocation (C++20 coroutines)
+// Frames are recycled through per-thread free lists by size class, so starting
+// a coroutine is usually a pointer pop instead of a trip to the global heap
+// whenever the compiler can't elide the allocation altogether. Unlike Pool,
+// every slot is its own heap block: a frame may finish on another thread than
+// it started on, and each thread frees the slots it cached when it exits.
+class FrameCache {
+public:
+    static void* allocate(size_t size) {
+        size_t cls = size_class(size);
+        if (cls == kClasses) return ::operator new(size);
+        Lists& lists = local();
+        if (Slot* slot = lists.free[cls]) {
+            lists.free[cls] = slot->next;
+            --lists.count[cls];
+            return slot;
+        }
+        return ::operator new(kSlotSize << cls);
+    }
+
+    static void deallocate(void* frame, size_t size) noexcept {
+        size_t cls = size_class(size);
+        Lists& lists = local();
+        if (cls == kClasses || lists.count[cls] == kMaxCached) {
+            ::operator delete(frame);
+            return;
+        }
+        auto* slot = static_cast<Slot*>(frame);
+        slot->next = lists.free[cls];
+        lists.free[cls] = slot;
+        ++lists.count[cls];
+    }
+
+private:
+    struct Slot {
+        Slot* next;
+    };
+
+    static constexpr size_t kSlotSize  = 128;  // smallest class; classes double up to 1 KiB
+    static constexpr size_t kClasses   = 4;
+    static constexpr size_t kMaxCached = 256;  // per class and thread
+
+    struct Lists {
+        std::array<Slot*, kClasses>  free{};
+        std::array<size_t, kClasses> count{};
+
+        ~Lists() {
+            for (Slot* slot : free) {
+                while (slot) ::operator delete(std::exchange(slot, slot->next));
+            }
+        }
+    };
+
+    static size_t size_class(size_t size) {
+        size_t cls = 0;
+        while (cls < kClasses && (kSlotSize << cls) < size) ++cls;
+        return cls;
+    }
 
-struct BaseFinal {
-    virtual void foo() {}
+    static Lists& local() {
+        thread_local Lists lists;
+        return lists;
+    }
 };
 
-struct DerivedFinal : public BaseFinal {
-    void foo() final { std::cout << "DerivedFinal::foo (final)\n"; }
+// Promise base that sends coroutine frames through FrameCache
+struct CachedFrame {
+    static void* operator new(size_t size) { return FrameCache::allocate(size); }
+    static void  operator delete(void* frame, size_t size) noexcept { FrameCache::deallocate(frame, size); }
 };
 
-// Operator <=> (three-way comparator) (C++20)
-struct Point3 {
-    float x, y;
-    constexpr auto operator<=>(const Point3& other) const = default;
+template<typename T>
+struct TaskResult {
+    std::optional<T> value;
+    void return_value(T result) { value.emplace(std::move(result)); }
+    T take() { return std::move(*value); }
 };
 
-// Defaulted special member functions (C++11)
-struct DefaultMembers {
-    DefaultMembers() = default;
-    DefaultMembers(const DefaultMembers&) = default;
-    DefaultMembers(DefaultMembers&&) = default;
-    ~DefaultMembers() = default;
-    DefaultMembers& operator=(const DefaultMembers&) = default;
-    DefaultMembers& operator=(DefaultMembers&&) = default;
+template<>
+struct TaskResult<void> {
+    void return_void() {}
+    void take() {}
 };
 
-// Deleted special member functions (C++11)
-struct DeletedMembers {
-    DeletedMembers() = delete;
-    DeletedMembers(const DeletedMembers&) = delete;
-    DeletedMembers(DeletedMembers&&) = delete;
-    ~DeletedMembers() = delete;
-    DeletedMembers& operator=(const DeletedMembers&) = delete;
-};
+// Lazy coroutine task: the body starts when the task is awaited, run by an
+// EventLoop or posted to a ThreadExecutor. When it finishes it resumes its
+// awaiter by symmetric transfer, so a chain of co_awaits needs no scheduler
+// round trip and does not grow the stack.
+template<typename T = void>
+class [[nodiscard]] Task {
+public:
+    struct promise_type : CachedFrame, TaskResult<T> {
+        std::coroutine_handle<> continuation = std::noop_coroutine();
+        std::exception_ptr      error;
+
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept {
+            struct ResumeAwaiter {
+                bool await_ready() noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> done) noexcept {
+                    return done.promise().continuation;
+                }
+                void await_resume() noexcept {}
+            };
+            return ResumeAwaiter{};
+        }
+        void unhandled_exception() { error = std::current_exception(); }
+    };
 
-// Ref-qualifiers (C++11)
-struct RefQualifier {
-    void foo() &  { std::cout << "Lvalue foo\n"; }
-    void foo() && { std::cout << "Rvalue foo\n"; }
-    void foo() const & { std::cout << "Const lvalue foo\n"; }
-    void foo() const &&{ std::cout << "Const rvalue foo\n"; }
-};
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (m_handle) m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+    ~Task() {
+        if (m_handle) m_handle.destroy();
+    }
 
-// Explicit object member functions (C++23)
-struct ExplicitMember {
-    std::string name;
-    void getName(this ExplicitMember& self) { std::cout << "Lvalue name: " << self.name << "\n"; }
-    void getName(this ExplicitMember&& self) { std::cout << "Rvalue name: " << std::move(self.name) << "\n"; }
-};
+    bool done() const { return !m_handle || m_handle.done(); }
+    std::coroutine_handle<> handle() const { return m_handle; }
 
-// Strongly typed enumeration (C++11)
-enum class StatusCode : uint8_t { OK = 0, Error = 1 };
+    // Result of a finished task; rethrows an exception that escaped its body
+    T result() { return result_of(m_handle); }
 
-// Multidimensional subscript operator (C++23)
-template<typename T>
-struct MultiArray {
-    T data[2][2][2];
-    T& operator[](size_t i, size_t j, size_t k) {
-        return data[i][j][k];
+    // co_await task.completed(): waits for the task without taking its result
+    auto completed() noexcept { return CompletionAwaiter{m_handle}; }
+
+    auto operator co_await() noexcept {
+        struct Awaiter : CompletionAwaiter {
+            T await_resume() { return result_of(this->handle); }
+        };
+        return Awaiter{{m_handle}};
     }
-    const T& operator[](size_t i, size_t j, size_t k) const {
-        return data[i][j][k];
+
+private:
+    struct CompletionAwaiter {
+        std::coroutine_handle<promise_type> handle;
+        bool await_ready() const noexcept { return handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+        void await_resume() const noexcept {}
+    };
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+    static T result_of(std::coroutine_handle<promise_type> handle) {
+        if (handle.promise().error) std::rethrow_exception(handle.promise().error);
+        return handle.promise().take();
     }
+
+    std::coroutine_handle<promise_type> m_handle;
 };
 
-void test_object_oriented() {
-    InClassInit ic;
-    std::cout << "InClassInit value: " << ic.value << "\n";
+// Synchronous generator for range-for loops; yielded values are referenced, not copied
+template<typename T>
+class [[nodiscard]] Generator {
+public:
+    struct promise_type : CachedFrame {
+        const T*           current = nullptr;
+        std::exception_ptr error;
+
+        Generator get_return_object() { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(const T& value) noexcept {
+            current = std::addressof(value);
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() { error = std::current_exception(); }
 
-    std::cout << "InlineStaticInit static_val: " << InlineStaticInit::static_val << "\n";
+        template<typename U>
+        void await_transform(U&&) = delete; // generators are synchronous
+    };
 
-    Delegating d1;
-    Delegating d2(123);
-    std::cout << "Delegating d1.value: " << d1.value << ", d2.value: " << d2.value << "\n";
+    class iterator {
+    public:
+        using value_type      = T;
+        using difference_type = ptrdiff_t;
+
+        explicit iterator(std::coroutine_handle<promise_type> handle = {}) : m_handle(handle) {}
+        const T& operator*() const { return *m_handle.promise().current; }
+        iterator& operator++() {
+            m_handle.resume();
+            rethrow(m_handle);
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        friend bool operator==(const iterator& it, std::default_sentinel_t) { return it.m_handle.done(); }
 
-    InheritedCtor ih1;
-    InheritedCtor ih2(456);
-    std::cout << "InheritedCtor ih1.value: " << ih1.value << ", ih2.value: " << ih2.value << "\n";
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+    };
 
-    ClsMove cm1;
-    ClsMove cm2 = std::move(cm1);
-    std::cout << "ClsMove cm2.ptr: " << (cm2.ptr ? *cm2.ptr : -1) << "\n";
+    Generator(Generator&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+    Generator& operator=(Generator&&) = delete;
+    ~Generator() {
+        if (m_handle) m_handle.destroy();
+    }
 
-    BoolWrapper bw(true);
-    bool bw_bool = static_cast<bool>(bw);
-    std::cout << "BoolWrapper as bool: " << std::boolalpha << bw_bool << "\n";
+    iterator begin() {
+        m_handle.resume();
+        rethrow(m_handle);
+        return iterator(m_handle);
+    }
+    std::default_sentinel_t end() const { return {}; }
 
-    DerivedVirtual dv;
-    BaseVirtual* bv = &dv;
-    bv->foo(); // calls BaseVirtual::foo
-    bv->bar(); // calls DerivedVirtual::bar
+private:
+    explicit Generator(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
 
-    FinalClass fc;
-    fc.display();
+    static void rethrow(std::coroutine_handle<promise_type> handle) {
+        if (handle.promise().error) std::rethrow_exception(handle.promise().error);
+    }
 
-    DerivedFinal df;
-    df.foo();
+    std::coroutine_handle<promise_type> m_handle;
+};
 
-    Point3 p1{1.0f, 2.0f}, p2{1.0f, 2.0f};
-    if (p1 == p2) {
-        std::cout << "Points are equal\n";
+// Single-threaded event loop: resumes ready coroutines in FIFO order and wakes
+// sleeping ones when their deadline passes. post() is thread-safe, so a
+// coroutine that moved to a ThreadExecutor comes back with co_await
+// loop.schedule(). sleep_for() and spawn() belong to the loop thread.
+class EventLoop {
+public:
+    using clock = std::chrono::steady_clock;
+
+    // co_await loop.schedule(): continue on the loop thread, behind the coroutines already queued
+    auto schedule() {
+        struct Awaiter {
+            EventLoop& loop;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { loop.post(handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
     }
 
-    DefaultMembers dm;
+    // co_await loop.sleep_for(d): suspend without blocking the loop
+    auto sleep_for(clock::duration delay) {
+        struct Awaiter {
+            EventLoop&        loop;
+            clock::time_point deadline;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { loop.m_timers.push({deadline, handle}); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this, clock::now() + delay};
+    }
 
-    // DeletedMembers dm2; // Error: constructor deleted
+    void post(std::coroutine_handle<> handle) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_ready.push_back(handle);
+        }
+        m_wake.notify_one();
+    }
 
-    RefQualifier rq;
-    rq.foo();          // lvalue
-    RefQualifier().foo(); // rvalue
+    // Starts a fire-and-forget task; the loop owns it until run() sees it finish
+    void spawn(Task<> task) {
+        Spawned& spawned = m_spawned.emplace_back(*this, std::move(task));
+        post(spawned.root.handle());
+    }
 
-    ExplicitMember em{"Charlie"};
-    em.getName();      // lvalue overload
-    ExplicitMember{"Dave"}.getName(); // rvalue overload
+    // Runs the loop until `task` finishes and returns its result
+    template<typename T>
+    T run(Task<T> task) {
+        bool    finished = false;
+        Task<T> root     = finish_on_loop(std::move(task), finished);
+        post(root.handle());
+        while (!finished) run_once();
+        return root.result();
+    }
 
-    StatusCode sc = StatusCode::OK;
-    // int code = sc; // Error: no implicit conversion
-    int code = static_cast<int>(sc);
-    std::cout << "StatusCode as int: " << code << "\n";
+    // Runs the loop until every spawned task has finished
+    void run() {
+        while (true) {
+            for (auto& spawned : m_spawned) {
+                if (spawned.finished) spawned.root.result(); // rethrows a failure
+            }
+            std::erase_if(m_spawned, [](const Spawned& spawned) { return spawned.finished; });
+            if (m_spawned.empty()) break;
+            run_once();
+        }
+    }
 
-    MultiArray<int> ma{};
-    ma[0, 0, 0] = 7;
-    std::cout << "MultiArray[0,0,0]: " << ma[0, 0, 0] << "\n";
-}
+private:
+    // Owns `task` and hops back to the loop thread once it finishes, so the loop
+    // never inspects a coroutine that a ThreadExecutor worker may be resuming.
+    // `finished` is set on the loop thread, right before the root completes.
+    template<typename T>
+    Task<T> finish_on_loop(Task<T> task, bool& finished) {
+        co_await task.completed();
+        co_await schedule();
+        finished = true;
+        co_return task.result();
+    }
 
-// =============================
-// Templates
-// =============================
+    // A spawned task's root; list nodes keep `finished` at a stable address
+    struct Spawned {
+        bool   finished = false;
+        Task<> root;
+        Spawned(EventLoop& loop, Task<> task) : root(loop.finish_on_loop(std::move(task), finished)) {}
+    };
+    struct Timer {
+        clock::time_point       deadline;
+        std::coroutine_handle<> handle;
+        bool operator>(const Timer& other) const { return deadline > other.deadline; }
+    };
 
-// Extern template (C++11)
-// In header: extern template class std::vector<int>;
-// In one translation unit:
-template class std::vector<int>;
+    // Resumes everything that is ready now; with nothing ready, waits for the next timer or a post
+    void run_once() {
+        for (auto now = clock::now(); !m_timers.empty() && m_timers.top().deadline <= now; m_timers.pop()) {
+            m_batch.push_back(m_timers.top().handle);
+        }
+        {
+            std::unique_lock lock(m_mutex);
+            if (m_batch.empty() && m_ready.empty()) {
+                auto has_ready = [this] { return !m_ready.empty(); };
+                if (m_timers.empty()) m_wake.wait(lock, has_ready);
+                else m_wake.wait_until(lock, m_timers.top().deadline, has_ready);
+            }
+            m_batch.insert(m_batch.end(), m_ready.begin(), m_ready.end());
+            m_ready.clear();
+        }
+        for (std::coroutine_handle<> handle : m_batch) handle.resume();
+        m_batch.clear();
+    }
 
-// Right-angle brackets (C++11)
-std::vector<std::vector<std::vector<int>>> nestedVec;
+    std::mutex                              m_mutex;   // guards m_ready
+    std::condition_variable                 m_wake;
+    std::vector<std::coroutine_handle<>>    m_ready;
+    std::vector<std::coroutine_handle<>>    m_batch;   // loop thread only
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<>> m_timers;
+    std::list<Spawned>                      m_spawned;
+};
 
-// Template argument deduction for class templates (C++17)
-std::vector vec_ctad = {1, 2, 3, 4}; // deduced as std::vector<int>
+// Optional multi-threaded executor: co_await executor.schedule() moves the rest
+// of a coroutine onto a worker thread, e.g. for a compute step between two
+// I/O waits on the EventLoop.
+class ThreadExecutor {
+public:
+    explicit ThreadExecutor(unsigned threads = std::max(1u, std::thread::hardware_concurrency())) {
+        for (unsigned i = 0; i < threads; ++i) {
+            m_threads.emplace_back([this] { worker_main(); });
+        }
+    }
 
-// Template aliases (C++11)
-template <typename T>
-using VecAlias = std::vector<T>;
+    // Runs what is already queued, then joins the workers
+    ~ThreadExecutor() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& thread : m_threads) thread.join();
+    }
 
-// Variadic templates (C++11)
-template<typename T>
-T sum_variadic(T value) {
-    return value;
+    ThreadExecutor(const ThreadExecutor&) = delete;
+    ThreadExecutor& operator=(const ThreadExecutor&) = delete;
+
+    auto schedule() {
+        struct Awaiter {
+            ThreadExecutor& executor;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { executor.post(handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
+    }
+
+    void post(std::coroutine_handle<> handle) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_queue.push_back(handle);
+        }
+        m_wake.notify_one();
+    }
+
+private:
+    void worker_main() {
+        while (true) {
+            std::coroutine_handle<> handle;
+            {
+                std::unique_lock lock(m_mutex);
+                m_wake.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+                if (m_queue.empty()) return;
+                handle = m_queue.front();
+                m_queue.pop_front();
+            }
+            handle.resume();
+        }
+    }
+
+    std::vector<std::thread>            m_threads;
+    std::mutex                          m_mutex;   // guards m_queue and m_stop
+    std::condition_variable             m_wake;
+    std::deque<std::coroutine_handle<>> m_queue;
+    bool                                m_stop = false;
+};
+
+Generator<long long> fibonacci(int count) {
+    long long a = 0, b = 1;
+    for (int i = 0; i < count; ++i) {
+        co_yield a;
+        a = std::exchange(b, a + b);
+    }
 }
 
-template<typename T, typename... Ts>
-T sum_variadic(T head, Ts... tail) {
-    return head + sum_variadic(tail...);
+// Stands in for a request that waits on I/O
+Task<int> fetch_value(EventLoop& loop, int id, std::chrono::microseconds latency) {
+    co_await loop.sleep_for(latency);
+    co_return id * 10;
 }
 
-// Fold expressions (C++17)
-template<typename... Ts>
-auto sum_fold(Ts... args) {
-    return (args + ...);
+// Compute step on the executor, then back to the loop thread
+Task<long long> sum_squares_on(ThreadExecutor& executor, EventLoop& loop, int n) {
+    co_await executor.schedule();
+    long long total = 0;
+    for (int i = 0; i < n; ++i) total += static_cast<long long>(i) * i;
+    co_await loop.schedule();
+    co_return total;
 }
 
-void test_templates() {
-    std::cout << "sum_variadic(1,2.5,3): " << sum_variadic(1, 2.5, 3) << "\n";
-    std::cout << "sum_fold(1, 2, 3, 4): " << sum_fold(1, 2, 3, 4) << "\n";
+Task<long long> handle_request(EventLoop& loop, ThreadExecutor& executor, int id) {
+    int fetched = co_await fetch_value(loop, id, std::chrono::microseconds(200));
+    long long squares = co_await sum_squares_on(executor, loop, 1000);
+    co_return fetched + squares;
+}
 
-    VecAlias<int> myVec = {10, 20, 30};
-    for (auto v : myVec) {
-        std::cout << "VecAlias element: " << v << "\n";
+void test_coroutines() {
+    std::cout << "Generator fibonacci:";
+    for (long long value : fibonacci(10)) std::cout << " " << value;
+    std::cout << "\n";
+
+    EventLoop      loop;
+    ThreadExecutor executor(2);
+    std::cout << "handle_request(4): " << loop.run(handle_request(loop, executor, 4)) << "\n";
+
+    // Eight requests in flight on one thread: their I/O waits overlap
+    std::array<int, 8> results{};
+    auto start = EventLoop::clock::now();
+    for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+        loop.spawn([](EventLoop& loop, int id, int& out) -> Task<> {
+            out = co_await fetch_value(loop, id, std::chrono::milliseconds(2));
+        }(loop, i, results[i]));
     }
+    loop.run();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(EventLoop::clock::now() - start);
+    std::cout << "8 overlapped 2ms requests: sum " << std::accumulate(results.begin(), results.end(), 0)
+              << ", under 16ms: " << std::boolalpha << (elapsed < std::chrono::milliseconds(16)) << "\n";
 }
 
 // =============================
@@ -717,11 +4050,595 @@ void test_deprecated_features() {
     (void)x; (void)y;
 }
 
+// =============================
+// Benchmarks
+// =============================
+
+void run_benchmarks(BenchReport& report) {
+    // Whole test_* sections, output muted
+    {
+        MuteCout mute;
+        report.run("test_uniform_initialization", test_uniform_initialization);
+        report.run("test_aggregate_initialization", test_aggregate_initialization);
+        report.run("test_designated_initializers", test_designated_initializers);
+        report.run("test_type_inference", test_type_inference);
+        report.run("test_control_flow", test_control_flow);
+        report.run("test_lambdas", test_lambdas);
+        report.run("test_other_parts", test_other_parts);
+        report.run("test_object_oriented", test_object_oriented);
+        report.run("test_templates", test_templates);
+        report.run("test_coroutines", test_coroutines);
+    }
+
+    // Compile-time vs run-time: the constant-evaluated result costs nothing
+    report.run("power() constant-evaluated", [] {
+        constexpr double r = power(2.0, 10);
+        do_not_optimize(r);
+    });
+    report.run("power() run-time std::pow", [] {
+        double base = 2.0;
+        int    exp  = 10;
+        do_not_optimize(base);
+        do_not_optimize(exp);
+        do_not_optimize(power(base, exp));
+    });
+
+    // Compile-time tables vs the run-time std::pow branch of power()
+    report.run("pow_table<3, 32> lookup", [] {
+        size_t exp = 13;
+        do_not_optimize(exp);
+        do_not_optimize(pow_table<3, 32>[exp]);
+    });
+    report.run("power(3.0, 13) run-time", [] {
+        double base = 3.0;
+        int    exp  = 13;
+        do_not_optimize(base);
+        do_not_optimize(exp);
+        do_not_optimize(power(base, exp));
+    });
+    report.run("sin_q15 lookup", [] {
+        int deg = 37;
+        do_not_optimize(deg);
+        do_not_optimize(sin_q15(deg));
+    });
+    report.run("std::sin", [] {
+        double rad = 37.0_deg;
+        do_not_optimize(rad);
+        do_not_optimize(std::sin(rad));
+    });
+
+    // Recursive variadic template vs fold expression
+    report.run("sum_variadic(a, b, c, d)", [] {
+        int a = 1, b = 2, c = 3, d = 4;
+        do_not_optimize(a); do_not_optimize(b); do_not_optimize(c); do_not_optimize(d);
+        do_not_optimize(sum_variadic(a, b, c, d));
+    });
+    report.run("sum_fold(a, b, c, d)", [] {
+        int a = 1, b = 2, c = 3, d = 4;
+        do_not_optimize(a); do_not_optimize(b); do_not_optimize(c); do_not_optimize(d);
+        do_not_optimize(sum_fold(a, b, c, d));
+    });
+
+    // Range folds: plain scalar loop vs lane-split + threaded fold
+    {
+        std::vector<double> values(size_t{1} << 22);
+        for (size_t i = 0; i < values.size(); ++i) values[i] = static_cast<double>(i % 1000) * 0.5;
+
+        report.run("scalar loop sum (4M doubles)", [&values] {
+            double total = 0;
+            for (double v : values) total += v;
+            do_not_optimize(total);
+        });
+        report.run("sum_range Fast (4M doubles)", [&values] {
+            do_not_optimize(sum_range(values));
+        });
+        report.run("sum_range Deterministic (4M doubles)", [&values] {
+            do_not_optimize(sum_range(values, FoldOrder::Deterministic));
+        });
+    }
+
+    // Small owning handles: global heap vs Pool, copies vs moves (1000 per sample)
+    {
+        constexpr size_t kHandles = 1000;
+        report.run("ClsMove create/destroy x1000 (new/delete)", [] {
+            std::vector<ClsMove> handles(kHandles);
+            do_not_optimize(handles.data());
+        });
+        report.run("PooledClsMove create/destroy x1000 (Pool)", [] {
+            std::vector<PooledClsMove> handles(kHandles);
+            do_not_optimize(handles.data());
+        });
+
+        std::vector<ClsMove> source(kHandles);
+        report.run("ClsMove copy x1000", [&source] {
+            std::vector<ClsMove> copies;
+            copies.reserve(kHandles);
+            for (const auto& h : source) copies.push_back(h);
+            do_not_optimize(copies.data());
+        });
+        report.run("ClsMove move x1000", [&source] {
+            std::vector<ClsMove> moved;
+            moved.reserve(kHandles);
+            for (auto& h : source) moved.push_back(std::move(h));
+            source.swap(moved); // hand the payloads back for the next sample
+            do_not_optimize(source.data());
+        });
+    }
+
+    // Serial loop vs parallel_for on the work-stealing pool
+    {
+        std::vector<float> values(size_t{1} << 22, 2.0f);
+        report.run("serial sqrt (4M floats)", [&values] {
+            for (float& v : values) v = std::sqrt(v + 1.0f);
+            do_not_optimize(values.data());
+        });
+        report.run("parallel_for sqrt (4M floats)", [&values] {
+            default_pool().parallel_for(0, values.size(), 1 << 15, [&values](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) values[i] = std::sqrt(values[i] + 1.0f);
+            });
+            do_not_optimize(values.data());
+        });
+    }
+
+    // Contended counter: one shared atomic vs per-thread shards
+    for (unsigned threads : {1u, std::max(2u, std::thread::hardware_concurrency())}) {
+        constexpr int kIncrements = 100'000;
+        auto hammer = [threads](auto&& increment) {
+            std::vector<std::thread> pool;
+            for (unsigned t = 0; t < threads; ++t) {
+                pool.emplace_back([&increment] {
+                    for (int i = 0; i < kIncrements; ++i) increment();
+                });
+            }
+            for (auto& th : pool) th.join();
+        };
+        std::string suffix = " (" + std::to_string(threads) + " threads)";
+
+        std::atomic<int64_t> shared{0};
+        report.run("std::atomic<int64_t> add" + suffix, [&] {
+            hammer([&shared] { shared.fetch_add(1, std::memory_order_relaxed); });
+        });
+        ShardedCounter sharded;
+        report.run("ShardedCounter add" + suffix, [&] {
+            hammer([&sharded] { sharded.add(); });
+            do_not_optimize(sharded.value());
+        });
+    }
+
+    // Array-of-structs vs structure-of-arrays, touching two of three fields
+    {
+        constexpr size_t kPoints = 1 << 20;
+        std::vector<Point> aos(kPoints, Point{ .x = 1, .y = 2, .z = 3 });
+        SoA<Point> soa;
+        soa.reserve(kPoints);
+        for (const auto& p : aos) soa.push_back(p);
+
+        report.run("AoS x += y (1M Points)", [&aos] {
+            for (auto& p : aos) p.x += p.y;
+            do_not_optimize(aos.data());
+        });
+        report.run("SoA x += y (1M Points)", [&soa] {
+            auto xs = soa.column<0>();
+            auto ys = soa.column<1>();
+            for (size_t i = 0; i < xs.size(); ++i) xs[i] += ys[i];
+            do_not_optimize(xs.data());
+        });
+    }
+
+    // Per-component scalar math vs the Vec4/Mat4 kernels
+    {
+        std::vector<Vec4> in(1 << 16, Vec4{1, 2, 3, 1}), out(in.size());
+        Mat4 m = Mat4::identity();
+        m.cols[3] = {5, 6, 7, 1};
+        report.run("scalar mat*vec (64K Vec4)", [&] {
+            for (size_t i = 0; i < in.size(); ++i) {
+                const Vec4& v = in[i];
+                out[i] = { m.cols[0].x * v.x + m.cols[1].x * v.y + m.cols[2].x * v.z + m.cols[3].x * v.w,
+                           m.cols[0].y * v.x + m.cols[1].y * v.y + m.cols[2].y * v.z + m.cols[3].y * v.w,
+                           m.cols[0].z * v.x + m.cols[1].z * v.y + m.cols[2].z * v.z + m.cols[3].z * v.w,
+                           m.cols[0].w * v.x + m.cols[1].w * v.y + m.cols[2].w * v.z + m.cols[3].w * v.w };
+            }
+            do_not_optimize(out.data());
+        });
+        report.run("transform() (64K Vec4)", [&] {
+            transform(m, in, out);
+            do_not_optimize(out.data());
+        });
+    }
+
+    // Virtual calls vs devirtualized dispatch over a mixed batch of C and D.
+    // The virtual case calls through base pointers into the same contiguous
+    // variant storage, so only the dispatch differs, not the memory layout.
+    {
+        constexpr size_t kObjects = 1 << 18;
+        std::vector<ClosedVariant<C, D>> variants;
+        std::vector<const A*> bases;
+        TypeBuckets<C, D> buckets;
+        uint32_t rng = 12345;
+        for (size_t i = 0; i < kObjects; ++i) {
+            rng = rng * 1664525u + 1013904223u;
+            int value = static_cast<int>((rng >> 8) & 0xFF);
+            if (rng >> 31) {
+                variants.emplace_back(Sealed<C>(value));
+                buckets.emplace<C>(value);
+            } else {
+                variants.emplace_back(Sealed<D>(value));
+                buckets.emplace<D>(value);
+            }
+        }
+        bases.reserve(kObjects);
+        for (const auto& obj : variants) {
+            bases.push_back(std::visit([](const A& o) { return &o; }, obj));
+        }
+
+        report.run("virtual A::foo (256K mixed)", [&bases] {
+            int total = 0;
+            for (const A* obj : bases) total += obj->foo();
+            do_not_optimize(total);
+        });
+        report.run("std::visit Sealed foo (256K mixed)", [&variants] {
+            int total = 0;
+            for (const auto& obj : variants) total += std::visit([](const auto& o) { return o.foo(); }, obj);
+            do_not_optimize(total);
+        });
+        report.run("TypeBuckets foo (256K mixed)", [&buckets] {
+            int total = 0;
+            buckets.for_each([&total](const auto& o) { total += o.foo(); });
+            do_not_optimize(total);
+        });
+    }
+
+    // std::function vs InplaceFunction holding a 24-byte closure (past libstdc++'s 16-byte SBO)
+    {
+        int a = 1, b = 2, c = 3;
+        double d = 4.0;
+        do_not_optimize(a); do_not_optimize(d);
+        auto closure = [a, b, c, d](int x) { return a * x + b + c + static_cast<int>(d); };
+
+        report.run("std::function store + call", [&closure] {
+            std::function<int(int)> f = closure;
+            do_not_optimize(f(3));
+        });
+        report.run("InplaceFunction store + call", [&closure] {
+            InplaceFunction<int(int)> f = closure;
+            do_not_optimize(f(3));
+        });
+    }
+
+    // Copying istringstream extraction vs string_view tokens (1 MB of text)
+    {
+        std::string text;
+        while (text.size() < (1 << 20)) text += "lorem ipsum dolor sit amet,\tconsectetur adipiscing elit\n";
+
+        report.run("istringstream >> std::string (1 MB)", [&text] {
+            std::istringstream in(text);
+            std::string word;
+            size_t count = 0;
+            while (in >> word) ++count;
+            do_not_optimize(count);
+        });
+        report.run("Tokenizer string_view (1 MB)", [&text] {
+            Tokenizer tokens(text);
+            size_t count = 0;
+            while (tokens.next()) ++count;
+            do_not_optimize(count);
+        });
+    }
+
+    // Nested vectors rebuilt at startup vs a mapped JaggedArray file
+    {
+        std::vector<std::vector<std::vector<int>>> nested(2'000);
+        for (size_t i = 0; i < nested.size(); ++i) {
+            nested[i].resize(1 + i % 16);
+            for (size_t j = 0; j < nested[i].size(); ++j) nested[i][j].assign(1 + (i + j) % 24, static_cast<int>(i + j));
+        }
+        auto path = unique_temp_path("jagged_bench");
+        JaggedArray<int>(nested).save(path.c_str());
+
+        report.run("rebuild nested vectors (2K rows)", [&nested] {
+            auto copy = nested;
+            do_not_optimize(copy.data());
+        });
+        report.run("JaggedArray::load mmap (2K rows)", [&path] {
+            auto mapped = JaggedArray<int>::load(path.c_str());
+            do_not_optimize((*mapped)[1'999][0][0]);
+        });
+
+        JaggedArray<int> flat(nested);
+        report.run("sum nested vectors", [&nested] {
+            long long total = 0;
+            for (const auto& row : nested) for (const auto& inner : row) for (int v : inner) total += v;
+            do_not_optimize(total);
+        });
+        report.run("sum JaggedArray", [&flat] {
+            long long total = 0;
+            for (size_t i = 0; i < flat.size(); ++i) {
+                auto row = flat[i];
+                for (size_t j = 0; j < row.size(); ++j) for (int v : row[j]) total += v;
+            }
+            do_not_optimize(total);
+        });
+        report.run("sum JaggedArray::values()", [&flat] {
+            do_not_optimize(sum_range(flat.values()));
+        });
+        std::remove(path.c_str());
+    }
+
+    // Comparison sort vs radix sort on 1M Point3 records
+    {
+        std::vector<Point3> records(1 << 20);
+        uint32_t rng = 7;
+        for (auto& p : records) {
+            rng = rng * 1664525u + 1013904223u;
+            p = {static_cast<float>(rng >> 8) / 65536.0f - 128.0f, static_cast<float>(rng & 0xFFFF)};
+        }
+        std::vector<Point3> work(records.size());
+
+        report.run("std::sort Point3 (1M)", [&] {
+            work = records;
+            std::sort(work.begin(), work.end());
+            do_not_optimize(work.data());
+        });
+        report.run("sort_records Point3 (1M)", [&] {
+            work = records;
+            sort_records(work);
+            do_not_optimize(work.data());
+        });
+    }
+
+    // Lock-free queues: throughput with N producers and N consumers, plus SPSC round-trip latency
+    {
+        constexpr size_t kItems = 1 << 14;
+
+        auto spsc = std::make_unique<SpscQueue<size_t, 1024>>();
+        report.run("SpscQueue 1:1 (16K items)", [&] {
+            std::thread producer([&] {
+                for (size_t i = 0; i < kItems; ++i) {
+                    while (!spsc->try_push(size_t{i})) std::this_thread::yield();
+                }
+            });
+            size_t sum = 0;
+            for (size_t received = 0; received < kItems;) {
+                if (auto value = spsc->try_pop()) { sum += *value; ++received; }
+                else std::this_thread::yield();
+            }
+            producer.join();
+            do_not_optimize(sum);
+        });
+
+        auto mpmc = std::make_unique<MpmcQueue<size_t, 1024>>();
+        for (size_t threads : {1, 2, 4}) {
+            report.run("MpmcQueue " + std::to_string(threads) + ":" + std::to_string(threads) + " (16K items)", [&] {
+                std::atomic<size_t> remaining{kItems};
+                std::vector<std::thread> workers;
+                for (size_t t = 0; t < threads; ++t) {
+                    workers.emplace_back([&, t] {
+                        for (size_t i = t; i < kItems; i += threads) {
+                            while (!mpmc->try_push(size_t{i})) std::this_thread::yield();
+                        }
+                    });
+                    workers.emplace_back([&] {
+                        size_t sum = 0;
+                        while (remaining.load(std::memory_order_relaxed) > 0) {
+                            if (auto value = mpmc->try_pop()) { sum += *value; remaining.fetch_sub(1, std::memory_order_relaxed); }
+                            else std::this_thread::yield();
+                        }
+                        do_not_optimize(sum);
+                    });
+                }
+                for (auto& worker : workers) worker.join();
+            });
+        }
+
+        constexpr size_t kRoundTrips = 1 << 10;
+        auto ping = std::make_unique<SpscQueue<size_t, 16>>();
+        auto pong = std::make_unique<SpscQueue<size_t, 16>>();
+        report.run("SpscQueue round trip (1K)", [&] {
+            std::thread echo([&] {
+                for (size_t i = 0; i < kRoundTrips; ++i) {
+                    std::optional<size_t> value;
+                    while (!(value = ping->try_pop())) std::this_thread::yield();
+                    while (!pong->try_push(std::move(*value))) std::this_thread::yield();
+                }
+            });
+            for (size_t i = 0; i < kRoundTrips; ++i) {
+                while (!ping->try_push(size_t{i})) std::this_thread::yield();
+                while (!pong->try_pop()) std::this_thread::yield();
+            }
+            echo.join();
+        });
+    }
+
+    // Complex multiply: std::complex operator* vs interleaved and split kernels; FFT sizes
+    {
+        constexpr size_t kCount = 1 << 16;
+        std::vector<std::complex<float>> a(kCount, {1.0f, 0.5f}), b(kCount, {0.5f, -1.0f}), out(kCount);
+        ComplexArray<float> ia(kCount), ib(kCount);
+        ComplexArray<float, ComplexLayout::Split> sa(kCount), sb(kCount);
+        for (size_t i = 0; i < kCount; ++i) {
+            ia.set(i, a[i]); ib.set(i, b[i]);
+            sa.set(i, a[i]); sb.set(i, b[i]);
+        }
+
+        report.run("std::complex<float> mul (64K)", [&] {
+            for (size_t i = 0; i < kCount; ++i) out[i] = a[i] * b[i];
+            do_not_optimize(out.data());
+        });
+        report.run("ComplexArray interleaved mul (64K)", [&] {
+            ia *= ib;
+            do_not_optimize(ia.values().data());
+        });
+        report.run("ComplexArray split mul (64K)", [&] {
+            sa *= sb;
+            do_not_optimize(sa.real().data());
+        });
+
+        Fft<float>  fft_f(4096);
+        Fft<double> fft_d(4096);
+        std::vector<std::complex<float>>  data_f(4096, {1.0f, 0.0f});
+        std::vector<std::complex<double>> data_d(4096, {1.0, 0.0});
+        report.run("Fft<float> forward + inverse (4096)", [&] {
+            fft_f.forward(data_f);
+            fft_f.inverse(data_f);
+            do_not_optimize(data_f.data());
+        });
+        report.run("Fft<double> forward + inverse (4096)", [&] {
+            fft_d.forward(data_d);
+            fft_d.inverse(data_d);
+            do_not_optimize(data_d.data());
+        });
+    }
+
+    // Parsing status reason phrases: if-chain of string compares vs perfect hash
+    {
+        constexpr std::string_view phrases[] = {"OK", "Not Found", "Service Unavailable", "Created", "Bad Request", "Not Modified", "Teapot", "Forbidden"};
+        auto parse_chain = [](std::string_view s) -> std::optional<HttpStatus> {
+            if (s == "OK") return HttpStatus::Ok;
+            if (s == "Created") return HttpStatus::Created;
+            if (s == "No Content") return HttpStatus::NoContent;
+            if (s == "Moved Permanently") return HttpStatus::MovedPermanently;
+            if (s == "Not Modified") return HttpStatus::NotModified;
+            if (s == "Bad Request") return HttpStatus::BadRequest;
+            if (s == "Unauthorized") return HttpStatus::Unauthorized;
+            if (s == "Forbidden") return HttpStatus::Forbidden;
+            if (s == "Not Found") return HttpStatus::NotFound;
+            if (s == "Internal Server Error") return HttpStatus::InternalServerError;
+            if (s == "Service Unavailable") return HttpStatus::ServiceUnavailable;
+            return std::nullopt;
+        };
+        size_t next = 0;
+        report.run("HttpStatus parse: if-chain", [&] {
+            std::string_view phrase = phrases[next++ % std::size(phrases)];
+            do_not_optimize(phrase);
+            do_not_optimize(parse_chain(phrase));
+        });
+        report.run("HttpStatus parse: perfect hash", [&] {
+            std::string_view phrase = phrases[next++ % std::size(phrases)];
+            do_not_optimize(phrase);
+            do_not_optimize(http_status_names.from_string(phrase));
+        });
+    }
+
+    // Record names: std::string vs InternedString (storage per copy, equality scan)
+    {
+        constexpr std::string_view names[] = {"Alexandra Konstantinopoulou", "Maximilian Oberhauser-Schmidt", "Bartholomew Fitzgerald"};
+        std::vector<std::string>    plain;
+        std::vector<InternedString> interned;
+        for (size_t i = 0; i < 4096; ++i) {
+            plain.emplace_back(names[i % 3]);
+            interned.emplace_back(names[i % 3]);
+        }
+        std::string    wanted_plain(names[1]);
+        InternedString wanted_interned(names[1]);
+
+        report.run("std::string copy (4K names)", [&] {
+            std::vector<std::string> copy = plain;
+            do_not_optimize(copy.data());
+        });
+        report.run("InternedString copy (4K names)", [&] {
+            std::vector<InternedString> copy = interned;
+            do_not_optimize(copy.data());
+        });
+        report.run("std::string == scan (4K names)", [&] {
+            do_not_optimize(std::count(plain.begin(), plain.end(), wanted_plain));
+        });
+        report.run("InternedString == scan (4K names)", [&] {
+            do_not_optimize(std::count(interned.begin(), interned.end(), wanted_interned));
+        });
+    }
+
+    // Requests that wait on I/O: a thread per request vs coroutines on one EventLoop
+    {
+        constexpr int  kRequests = 8;
+        constexpr auto kLatency  = std::chrono::microseconds(100);
+        report.run("8 requests x 100us wait: thread each", [&] {
+            std::array<int, kRequests> results{};
+            std::vector<std::thread> threads;
+            for (int i = 0; i < kRequests; ++i) {
+                threads.emplace_back([i, &results, kLatency] {
+                    std::this_thread::sleep_for(kLatency);
+                    results[i] = i * 10;
+                });
+            }
+            for (auto& thread : threads) thread.join();
+            do_not_optimize(results.data());
+        });
+        report.run("8 requests x 100us wait: EventLoop", [&] {
+            std::array<int, kRequests> results{};
+            EventLoop loop;
+            for (int i = 0; i < kRequests; ++i) {
+                loop.spawn([](EventLoop& loop, int id, int& out) -> Task<> {
+                    out = co_await fetch_value(loop, id, kLatency);
+                }(loop, i, results[i]));
+            }
+            loop.run();
+            do_not_optimize(results.data());
+        });
+
+        // Cost of starting and awaiting a child task (frame from FrameCache)
+        auto child  = [](int i) -> Task<int> { co_return i + 1; };
+        auto parent = [child](int n) -> Task<int> {
+            int total = 0;
+            for (int i = 0; i < n; ++i) total += co_await child(i);
+            co_return total;
+        };
+        EventLoop loop;
+        report.run("co_await Task<int> x1000", [&] {
+            do_not_optimize(loop.run(parent(1000)));
+        });
+    }
+
+    // Pow: integral square-and-multiply vs floating-point library branches
+    report.run("Pow integral", [] {
+        int base = 3, exp = 13;
+        do_not_optimize(base); do_not_optimize(exp);
+        do_not_optimize(Pow(base, exp));
+    });
+    report.run("Pow float", [] {
+        float base = 3.0f;
+        int   exp  = 13;
+        do_not_optimize(base); do_not_optimize(exp);
+        do_not_optimize(Pow(base, exp));
+    });
+    report.run("Pow double", [] {
+        double base = 3.0;
+        int    exp  = 13;
+        do_not_optimize(base); do_not_optimize(exp);
+        do_not_optimize(Pow(base, exp));
+    });
+}
+
+// Runs each test_* section repeatedly under TRACE_SCOPE and reports its latency distribution
+void run_traces(std::ostream& os) {
+    auto trace = [&os](std::string_view name, void (*section)()) {
+        LatencyHistogram histogram;
+        {
+            MuteCout mute;
+            for (int i = 0; i < 1'000; ++i) {
+                TRACE_SCOPE(histogram);
+                section();
+            }
+        }
+        histogram.report(os, name);
+    };
+    trace("test_uniform_initialization", test_uniform_initialization);
+    trace("test_aggregate_initialization", test_aggregate_initialization);
+    trace("test_designated_initializers", test_designated_initializers);
+    trace("test_type_inference", test_type_inference);
+    trace("test_control_flow", test_control_flow);
+    trace("test_lambdas", test_lambdas);
+    trace("test_other_parts", test_other_parts);
+    trace("test_object_oriented", test_object_oriented);
+    trace("test_templates", test_templates);
+    trace("test_coroutines", test_coroutines);
+}
+
 // =============================
 // Main
 // =============================
 
-int main() {
+// Usage: example [--bench[=table|csv|json]] [--trace[=file]]
+int main(int argc, char* argv[]) {
     std::cout << MESSAGE << "\n";
     LOG("Starting example execution");
 
@@ -732,7 +4649,11 @@ int main() {
     std::cout << "identity_lambda(7): " << identity_lambda(7) << "\n";
     B b_obj;
     std::cout << "B::foo(): " << b_obj.foo() << "\n";
-    //std::cout << "constexpr build_list head value: " << my_list->value << "\n";
+#ifdef __cpp_constexpr_dynamic_alloc
+    std::cout << "constexpr build_list head value: " << my_list[0] << ", length: " << my_list.size() << "\n";
+    std::cout << "routes \"/users\": " << *routes.find("/users") << ", keywords: " << keywords.nodes.size() << " trie nodes, "
+              << "longest keyword prefix of \"constinit_value\": " << keywords.longest_prefix("constinit_value") << "\n";
+#endif
     ci_value += 1; // allowed
     std::cout << "constinit ci_value: " << ci_value << "\n";
     constexpr int imadd = immediate_add(3, 4);
@@ -745,6 +4666,18 @@ int main() {
     std::cout << "dec_sep: " << dec_sep << "\n";
     std::cout << "str0: " << str0 << ", str1: " << str1 << "\n";
     std::cout << "html snippet:\n" << html << "\n";
+    Tokenizer html_tokens(html, " \n<>/");
+    size_t token_count = 0;
+    while (auto token = html_tokens.next()) {
+        std::cout << (token_count++ ? " | " : "html tokens: ") << *token;
+    }
+    std::cout << "\n";
+    if (MappedFile source(__FILE__); source.is_open()) {
+        Tokenizer words(source.view());
+        size_t word_count = 0;
+        while (words.next()) ++word_count;
+        std::cout << "words in " << __FILE__ << ": " << word_count << "\n";
+    }
     std::cout << "comp1: " << comp1 << ", comp2: " << comp2 << "\n";
     std::cout << "duration_seconds (in seconds): " << std::chrono::duration_cast<std::chrono::seconds>(duration_seconds).count() << "\n";
     std::cout << "year2025: " << static_cast<int>(year2025) << ", day15: " << static_cast<unsigned>(day15) << "\n";
@@ -772,10 +4705,45 @@ int main() {
 
     // Templates testing
     test_templates();
+    test_jagged_file();
+
+    // Coroutines testing
+    test_coroutines();
 
     // Deprecated features testing
     test_deprecated_features();
 
     LOG("Example execution completed");
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg.starts_with("--trace")) {
+            if (arg.starts_with("--trace=")) {
+                std::string   path(arg.substr(8));
+                std::ofstream file(path);
+                if (!file.is_open()) {
+                    std::cerr << "cannot open trace file: " << path << "\n";
+                    return 1;
+                }
+                run_traces(file);
+            } else {
+                run_traces(std::cout);
+            }
+            continue;
+        }
+        if (!arg.starts_with("--bench")) {
+            continue;
+        }
+        BenchReport report;
+        run_benchmarks(report);
+        if (arg == "--bench=csv") {
+            report.write_csv(std::cout);
+        } else if (arg == "--bench=json") {
+            report.write_json(std::cout);
+        } else {
+            report.print_table(std::cout);
+        }
+    }
+
     return 0;
 }
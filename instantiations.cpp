@@ -0,0 +1,11 @@
+// instantiations.cpp
+// The one translation unit that instantiates the templates multi_array.h
+// declares extern when built with EXTERN_TEMPLATES=1
+
+#include "multi_array.h"
+
+#if EXTERN_TEMPLATES
+template class std::vector<int>;
+template class MultiArray<int>;
+template class MultiArray<float, 3, Layout::Tiled>;
+#endif
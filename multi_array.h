@@ -0,0 +1,168 @@
+// multi_array.h
+// MultiArray, split out of example.cpp so its instantiations can live in a
+// single translation unit (see instantiations.cpp)
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// Multidimensional subscript operator (C++23)
+// N-dimensional array with compile-time rank and runtime extents.
+// Tiled stores Tile^Rank blocks contiguously, so neighbours along every axis
+// share cache lines (extents must be multiples of Tile, otherwise the
+// constructor throws std::invalid_argument).
+enum class Layout { RowMajor, ColumnMajor, Tiled };
+
+template<typename T, size_t Rank = 3, Layout L = Layout::RowMajor, size_t Tile = 8>
+class MultiArray {
+    static_assert(Rank > 0);
+    static_assert(Tile > 0 && (Tile & (Tile - 1)) == 0, "Tile must be a power of two");
+
+public:
+    MultiArray() = default;
+
+    template<std::convertible_to<size_t>... Ts>
+        requires (sizeof...(Ts) == Rank)
+    explicit MultiArray(Ts... extents) : m_extents{static_cast<size_t>(extents)...} {
+        size_t count = 1;
+        for (size_t d = 0; d < Rank; ++d) {
+            if constexpr (L == Layout::Tiled) {
+                if (m_extents[d] % Tile != 0) {
+                    throw std::invalid_argument("MultiArray: tiled extents must be multiples of Tile");
+                }
+                m_tiles[d] = m_extents[d] / Tile;
+            }
+            count *= m_extents[d];
+        }
+        m_data.resize(count);
+    }
+
+    template<std::convertible_to<size_t>... Ts>
+        requires (sizeof...(Ts) == Rank)
+    T& operator[](Ts... idx) {
+        return m_data[offset({static_cast<size_t>(idx)...})];
+    }
+
+    template<std::convertible_to<size_t>... Ts>
+        requires (sizeof...(Ts) == Rank)
+    const T& operator[](Ts... idx) const {
+        return m_data[offset({static_cast<size_t>(idx)...})];
+    }
+
+    size_t   extent(size_t d) const { return m_extents[d]; }
+    size_t   size() const           { return m_data.size(); }
+    T*       data()                 { return m_data.data(); }
+    const T* data() const           { return m_data.data(); }
+
+    // Element-wise kernels: flat loops over contiguous storage, which the
+    // compiler turns into SIMD code. Both operands must share extents and layout.
+    MultiArray& operator+=(const MultiArray& other) { return apply(other, [](T a, T b) { return a + b; }); }
+    MultiArray& operator-=(const MultiArray& other) { return apply(other, [](T a, T b) { return a - b; }); }
+    MultiArray& operator*=(const MultiArray& other) { return apply(other, [](T a, T b) { return a * b; }); }
+    MultiArray& operator*=(T scalar) {
+        T* __restrict dst = m_data.data();
+        for (size_t i = 0, n = m_data.size(); i < n; ++i) {
+            dst[i] *= scalar;
+        }
+        return *this;
+    }
+
+    template<typename Op>
+    MultiArray& apply(const MultiArray& other, Op op) {
+        assert(m_extents == other.m_extents);
+        T* __restrict dst = m_data.data();
+        const T* __restrict src = other.m_data.data();
+        for (size_t i = 0, n = m_data.size(); i < n; ++i) {
+            dst[i] = op(dst[i], src[i]);
+        }
+        return *this;
+    }
+
+    // Reductions keep independent accumulators per lane: this breaks the
+    // serial dependency chain so floating-point sums vectorize without -ffast-math.
+    template<typename Op>
+    T reduce(T init, Op op) const {
+        constexpr size_t kLanes = 8;
+        const T* src = m_data.data();
+        const size_t n = m_data.size();
+        if (n < kLanes) {
+            for (size_t i = 0; i < n; ++i) init = op(init, src[i]);
+            return init;
+        }
+        T acc[kLanes];
+        for (size_t l = 0; l < kLanes; ++l) acc[l] = src[l];
+        size_t i = kLanes;
+        for (; i + kLanes <= n; i += kLanes) {
+            for (size_t l = 0; l < kLanes; ++l) {
+                acc[l] = op(acc[l], src[i + l]);
+            }
+        }
+        for (; i < n; ++i) acc[0] = op(acc[0], src[i]);
+        for (size_t l = 0; l < kLanes; ++l) init = op(init, acc[l]);
+        return init;
+    }
+
+    T sum() const { return reduce(T{}, [](T a, T b) { return a + b; }); }
+    T min() const { assert(size() > 0); return reduce(m_data[0], [](T a, T b) { return b < a ? b : a; }); }
+    T max() const { assert(size() > 0); return reduce(m_data[0], [](T a, T b) { return a < b ? b : a; }); }
+
+    // Cache-blocked transpose: reads and writes stay inside a Tile x Tile block
+    MultiArray transposed() const requires (Rank == 2) {
+        MultiArray result(m_extents[1], m_extents[0]);
+        const size_t rows = m_extents[0], cols = m_extents[1];
+        for (size_t bi = 0; bi < rows; bi += Tile) {
+            for (size_t bj = 0; bj < cols; bj += Tile) {
+                for (size_t i = bi; i < std::min(bi + Tile, rows); ++i) {
+                    for (size_t j = bj; j < std::min(bj + Tile, cols); ++j) {
+                        result[j, i] = (*this)[i, j];
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    size_t offset(const std::array<size_t, Rank>& idx) const {
+        size_t off = 0;
+        if constexpr (L == Layout::RowMajor) {
+            for (size_t d = 0; d < Rank; ++d) off = off * m_extents[d] + idx[d];
+        } else if constexpr (L == Layout::ColumnMajor) {
+            for (size_t d = Rank; d-- > 0;) off = off * m_extents[d] + idx[d];
+        } else {
+            size_t inner = 0;
+            for (size_t d = 0; d < Rank; ++d) {
+                off   = off * m_tiles[d] + idx[d] / Tile;
+                inner = inner * Tile + idx[d] % Tile;
+            }
+            off = off * kTileVolume + inner;
+        }
+        return off;
+    }
+
+    static constexpr size_t kTileVolume = [] {
+        size_t v = 1;
+        for (size_t d = 0; d < Rank; ++d) v *= Tile;
+        return v;
+    }();
+
+    std::array<size_t, Rank> m_extents{};
+    std::array<size_t, Rank> m_tiles{};
+    std::vector<T>           m_data;
+};
+
+// Explicit instantiation build mode (EXTERN_TEMPLATES=1): every translation
+// unit that includes this header skips instantiating these, and
+// instantiations.cpp holds the one definition of each. The std::vector<int>
+// declaration also covers VecAlias<int>, an alias is not a new type.
+#if EXTERN_TEMPLATES
+extern template class std::vector<int>;
+extern template class MultiArray<int>;
+extern template class MultiArray<float, 3, Layout::Tiled>;
+#endif